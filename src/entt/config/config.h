@@ -35,6 +35,18 @@
 #    define ENTT_PACKED_PAGE 1024
 #endif
 
+#ifndef ENTT_VIEW_PREFETCH
+#    define ENTT_VIEW_PREFETCH 0
+#endif
+
+#ifndef ENTT_PREFETCH
+#    if defined __clang__ || defined __GNUC__
+#        define ENTT_PREFETCH(addr) __builtin_prefetch(addr)
+#    else
+#        define ENTT_PREFETCH(addr) (void(addr))
+#    endif
+#endif
+
 #ifdef ENTT_DISABLE_ASSERT
 #    undef ENTT_ASSERT
 #    define ENTT_ASSERT(condition, msg) (void(0))
@@ -2,10 +2,14 @@
 #define ENTT_CORE_ALGORITHM_HPP
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
+#include "type_traits.hpp"
 #include "utility.hpp"
 
 namespace entt {
@@ -68,6 +72,91 @@ struct insertion_sort {
     }
 };
 
+/**
+ * @brief Provides the member constant `value` to true if a given type is an
+ * executor, false otherwise.
+ *
+ * An executor is a callable object that accepts a first and a last index and
+ * a function object. It invokes the function once for each index in the range,
+ * possibly concurrently, and returns when all the invocations are completed:
+ *
+ * @code{.cpp}
+ * void(std::size_t first, std::size_t last, auto task);
+ * @endcode
+ *
+ * Function objects that also accept further arguments (for example, variadic
+ * comparators) aren't considered executors.
+ *
+ * @tparam Type The type to test.
+ */
+template<typename Type, typename = void>
+struct is_executor: std::false_type {};
+
+/*! @copydoc is_executor */
+template<typename Type>
+struct is_executor<Type, std::enable_if_t<std::is_invocable_v<Type &, std::size_t, std::size_t, void (*)(std::size_t)> && !std::is_invocable_v<Type &, std::size_t, std::size_t, void (*)(std::size_t), std::size_t>>>: std::true_type {};
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type The type to test.
+ */
+template<typename Type>
+inline constexpr bool is_executor_v = is_executor<Type>::value;
+
+/**
+ * @brief Function object for performing parallel merge sort.
+ *
+ * The range is split in chunks that are sorted concurrently, then merged
+ * pairwise until a single sorted range remains. Each step is spread over the
+ * workers of the given executor.
+ */
+struct parallel_sort {
+    /**
+     * @brief Sorts the elements in a range.
+     *
+     * Sorts the elements in a range using the given binary comparison function.
+     *
+     * @warning
+     * The comparison function object is invoked concurrently from multiple
+     * workers and must be safe to call in this case.
+     *
+     * @tparam It Type of random access iterator.
+     * @tparam Compare Type of comparison function object.
+     * @tparam Executor Type of executor.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param compare A valid comparison function object.
+     * @param exec A valid executor.
+     */
+    template<typename It, typename Compare, typename Executor>
+    void operator()(It first, It last, Compare compare, Executor &&exec) const {
+        using difference_type = typename std::iterator_traits<It>::difference_type;
+        const auto length = static_cast<std::size_t>(std::distance(first, last));
+        std::size_t chunks = 1u;
+
+        for(; chunks < max_chunks && !((length / chunks) < 2u * min_chunk_size); chunks *= 2u) {}
+
+        auto bound = [first, length, chunks](const std::size_t pos) {
+            return first + static_cast<difference_type>(length * pos / chunks);
+        };
+
+        exec(std::size_t{}, chunks, [&bound, &compare](const std::size_t pos) {
+            std::sort(bound(pos), bound(pos + 1u), compare);
+        });
+
+        for(std::size_t width = 1u; width < chunks; width *= 2u) {
+            exec(std::size_t{}, chunks / (2u * width), [&bound, &compare, width](const std::size_t pos) {
+                const auto lo = pos * 2u * width;
+                std::inplace_merge(bound(lo), bound(lo + width), bound(lo + 2u * width), compare);
+            });
+        }
+    }
+
+private:
+    static constexpr std::size_t max_chunks = 64u;
+    static constexpr std::size_t min_chunk_size = 1024u;
+};
+
 /**
  * @brief Function object for performing LSD radix sort.
  * @tparam Bit Number of bits processed per pass.
@@ -86,6 +175,10 @@ struct radix_sort {
      * This implementation is inspired by the online book
      * [Physically Based Rendering](http://www.pbr-book.org/3ed-2018/Primitives_and_Intersection_Acceleration/Bounding_Volume_Hierarchies.html#RadixSort).
      *
+     * The histograms of all the passes are built with a single scan of the
+     * range. Passes for which all elements fall into the same bucket are
+     * skipped entirely.
+     *
      * @tparam It Type of random access iterator.
      * @tparam Getter Type of _getter_ function object.
      * @param first An iterator to the first element of the range to sort.
@@ -94,42 +187,193 @@ struct radix_sort {
      */
     template<typename It, typename Getter = identity>
     void operator()(It first, It last, Getter getter = Getter{}) const {
+        (*this)(std::move(first), std::move(last), std::move(getter), std::allocator<typename std::iterator_traits<It>::value_type>{});
+    }
+
+    /**
+     * @brief Sorts the elements in a range.
+     *
+     * Additional arguments are any of the following, in this order:
+     *
+     * * An executor, to spread the histograms and the scattering of each pass
+     *   over multiple workers.
+     * * Either a random access iterator to a scratch buffer with room for at
+     *   least as many elements as the range to sort, or an allocator to use
+     *   to create such a buffer.
+     *
+     * No memory is allocated by the sequential version when a scratch buffer
+     * is provided.
+     *
+     * @sa is_executor
+     *
+     * @tparam It Type of random access iterator.
+     * @tparam Getter Type of _getter_ function object.
+     * @tparam Arg Type of the first additional argument.
+     * @tparam Other Type of the other additional argument, if any.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param getter A valid _getter_ function object.
+     * @param arg An executor, a scratch buffer or an allocator.
+     * @param other A scratch buffer or an allocator, if any.
+     */
+    template<typename It, typename Getter, typename Arg, typename... Other>
+    void operator()(It first, It last, Getter getter, Arg &&arg, Other &&...other) const {
+        static_assert(sizeof...(Other) < 2u, "Too many arguments");
+
         if(first < last) {
-            constexpr auto passes = N / Bit;
+            if constexpr(is_executor_v<std::remove_reference_t<Arg>>) {
+                if constexpr(sizeof...(Other) == 0u) {
+                    with_scratch(first, last, std::allocator<typename std::iterator_traits<It>::value_type>{}, [&](auto out) { sort(first, last, out, getter, arg); });
+                } else {
+                    with_scratch(first, last, other..., [&](auto out) { sort(first, last, out, getter, arg); });
+                }
+            } else {
+                static_assert(sizeof...(Other) == 0u, "Invalid arguments");
+                with_scratch(first, last, arg, [&](auto out) { sort(first, last, out, getter); });
+            }
+        }
+    }
+
+private:
+    static constexpr auto passes = N / Bit;
+    static constexpr auto buckets = std::size_t{1u} << Bit;
+    static constexpr std::size_t max_chunks = 16u;
+    static constexpr std::size_t min_chunk_size = 4096u;
 
+    template<typename It, typename Arg, typename Func>
+    static void with_scratch(It first, It last, Arg &&arg, Func func) {
+        if constexpr(is_iterator_v<std::decay_t<Arg>>) {
+            func(arg);
+        } else {
             using value_type = typename std::iterator_traits<It>::value_type;
-            std::vector<value_type> aux(std::distance(first, last));
+            using alloc_type = typename std::allocator_traits<std::decay_t<Arg>>::template rebind_alloc<value_type>;
+            std::vector<value_type, alloc_type> aux(static_cast<std::size_t>(std::distance(first, last)), alloc_type{arg});
+            func(aux.begin());
+        }
+    }
 
-            auto part = [getter = std::move(getter)](auto from, auto to, auto out, auto start) {
-                constexpr auto mask = (1 << Bit) - 1;
-                constexpr auto buckets = 1 << Bit;
+    template<typename Value, typename Getter>
+    [[nodiscard]] static std::size_t digit(const Value &value, Getter &getter, const std::size_t pass) {
+        constexpr auto mask = (1 << Bit) - 1;
+        return static_cast<std::size_t>((getter(value) >> (pass * Bit)) & mask);
+    }
 
-                std::size_t index[buckets]{};
-                std::size_t count[buckets]{};
+    template<typename It, typename Out, typename Getter>
+    static void scatter(It from, It to, Out out, Getter &getter, const std::size_t pass, std::size_t *index) {
+        for(; from != to; ++from) {
+            out[index[digit(*from, getter, pass)]++] = std::move(*from);
+        }
+    }
+
+    template<typename It, typename Out, typename Getter>
+    static void sort(It first, It last, Out out, Getter &getter) {
+        const auto length = static_cast<std::size_t>(std::distance(first, last));
+        std::size_t count[passes][buckets]{};
+        bool swapped = false;
+
+        for(auto it = first; it != last; ++it) {
+            for(std::size_t pass{}; pass < passes; ++pass) {
+                ++count[pass][digit(*it, getter, pass)];
+            }
+        }
 
-                for(auto it = from; it != to; ++it) {
-                    ++count[(getter(*it) >> start) & mask];
+        for(std::size_t pass{}; pass < passes; ++pass) {
+            // passes for which all elements fall into the same bucket are skipped
+            if(count[pass][digit(swapped ? *out : *first, getter, pass)] != length) {
+                for(std::size_t bucket{}, offset{}; bucket < buckets; ++bucket) {
+                    offset += std::exchange(count[pass][bucket], offset);
                 }
 
-                for(std::size_t pos{}, end = buckets - 1u; pos < end; ++pos) {
-                    index[pos + 1u] = index[pos] + count[pos];
+                if(swapped) {
+                    scatter(out, out + length, first, getter, pass, count[pass]);
+                } else {
+                    scatter(first, last, out, getter, pass, count[pass]);
                 }
 
-                for(auto it = from; it != to; ++it) {
-                    out[index[(getter(*it) >> start) & mask]++] = std::move(*it);
+                swapped = !swapped;
+            }
+        }
+
+        if(swapped) {
+            std::move(out, out + length, first);
+        }
+    }
+
+    template<typename It, typename Out, typename Getter, typename Executor>
+    static void sort(It first, It last, Out out, Getter &getter, Executor &exec) {
+        using difference_type = typename std::iterator_traits<It>::difference_type;
+        const auto length = static_cast<std::size_t>(std::distance(first, last));
+        std::size_t chunks = 1u;
+
+        for(; chunks < max_chunks && !((length / chunks) < 2u * min_chunk_size); chunks *= 2u) {}
+
+        // chunk-major histograms, the same for all passes until elements move across chunks
+        std::vector<std::size_t> count(chunks * passes * buckets, 0u);
+        bool swapped = false;
+        bool moved = false;
+
+        auto bound = [length, chunks](const std::size_t chunk) {
+            return static_cast<difference_type>(length * chunk / chunks);
+        };
+
+        auto histogram = [&](auto from, const std::size_t chunk, const std::size_t pass, const std::size_t last_pass) {
+            for(auto it = from + bound(chunk), end = from + bound(chunk + 1u); it != end; ++it) {
+                for(auto curr = pass; curr < last_pass; ++curr) {
+                    ++count[(chunk * passes + curr) * buckets + digit(*it, getter, curr)];
                 }
-            };
+            }
+        };
 
-            for(std::size_t pass = 0; pass < (passes & ~1); pass += 2) {
-                part(first, last, aux.begin(), pass * Bit);
-                part(aux.begin(), aux.end(), first, (pass + 1) * Bit);
+        exec(std::size_t{}, chunks, [&](const std::size_t chunk) { histogram(first, chunk, 0u, passes); });
+
+        for(std::size_t pass{}; pass < passes; ++pass) {
+            const auto elem = digit(swapped ? *out : *first, getter, pass);
+            std::size_t total{};
+
+            for(std::size_t chunk{}; chunk < chunks; ++chunk) {
+                total += count[(chunk * passes + pass) * buckets + elem];
             }
 
-            if constexpr(passes & 1) {
-                part(first, last, aux.begin(), (passes - 1) * Bit);
-                std::move(aux.begin(), aux.end(), first);
+            // passes for which all elements fall into the same bucket are skipped
+            if(total != length) {
+                if(moved) {
+                    for(std::size_t chunk{}; chunk < chunks; ++chunk) {
+                        std::fill_n(count.begin() + (chunk * passes + pass) * buckets, buckets, 0u);
+                    }
+
+                    exec(std::size_t{}, chunks, [&](const std::size_t chunk) {
+                        if(swapped) {
+                            histogram(out, chunk, pass, pass + 1u);
+                        } else {
+                            histogram(first, chunk, pass, pass + 1u);
+                        }
+                    });
+                }
+
+                for(std::size_t bucket{}, offset{}; bucket < buckets; ++bucket) {
+                    for(std::size_t chunk{}; chunk < chunks; ++chunk) {
+                        offset += std::exchange(count[(chunk * passes + pass) * buckets + bucket], offset);
+                    }
+                }
+
+                exec(std::size_t{}, chunks, [&](const std::size_t chunk) {
+                    if(swapped) {
+                        scatter(out + bound(chunk), out + bound(chunk + 1u), first, getter, pass, count.data() + (chunk * passes + pass) * buckets);
+                    } else {
+                        scatter(first + bound(chunk), first + bound(chunk + 1u), out, getter, pass, count.data() + (chunk * passes + pass) * buckets);
+                    }
+                });
+
+                swapped = !swapped;
+                moved = true;
             }
         }
+
+        if(swapped) {
+            exec(std::size_t{}, chunks, [&](const std::size_t chunk) {
+                std::move(out + bound(chunk), out + bound(chunk + 1u), first + bound(chunk));
+            });
+        }
     }
 };
 
@@ -0,0 +1,443 @@
+#ifndef ENTT_CORE_PAGE_POOL_HPP
+#define ENTT_CORE_PAGE_POOL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "iterator.hpp"
+
+namespace entt {
+
+/**
+ * @brief Recycler for blocks of memory of recurring sizes.
+ *
+ * Blocks returned to the pool are kept on a free list per size class rather
+ * than being released, up to a configurable high-water mark per class. Later
+ * requests of the same size and alignment are served from these lists.<br/>
+ * The pool only tracks a fixed number of size classes, that is, the first ones
+ * it's asked for, and never caches more bytes than its budget. Requests of any
+ * other size or larger than the budget go straight to the global allocator.
+ * This is meant to be shared by all the pools of a registry through a
+ * `page_allocator`, so that tearing down and filling a registry reuses warm
+ * pages rather than hammering the global allocator.
+ *
+ * Blocks too small to hold a pointer are never cached.
+ *
+ * @warning
+ * The pool isn't thread safe. Moreover, it must outlive all the allocators
+ * and containers that refer to it.
+ */
+class page_pool {
+    struct free_block {
+        free_block *next;
+    };
+
+    struct size_class {
+        std::size_t size;
+        std::size_t alignment;
+        std::size_t high_water_mark;
+        std::size_t count;
+        free_block *head;
+    };
+
+    [[nodiscard]] bool is_cacheable(const std::size_t size) const noexcept {
+        // blocks are never less aligned than the default new alignment, whatever the alignment requested
+        return !(size < sizeof(free_block)) && !(limit < size);
+    }
+
+    [[nodiscard]] static void *allocate_block(const std::size_t size, const std::size_t alignment) {
+        if(alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            return ::operator new(size, std::align_val_t{alignment});
+        }
+
+        return ::operator new(size);
+    }
+
+    static void deallocate_block(void *ptr, const std::size_t alignment) noexcept {
+        if(alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            ::operator delete(ptr, std::align_val_t{alignment});
+        } else {
+            ::operator delete(ptr);
+        }
+    }
+
+    [[nodiscard]] iterable_adaptor<size_class *> size_classes() noexcept {
+        return {classes.data(), classes.data() + used};
+    }
+
+    [[nodiscard]] size_class *find(const std::size_t size, const std::size_t alignment) noexcept {
+        const auto range = size_classes();
+        const auto it = std::find_if(range.begin(), range.end(), [size, alignment](const auto &elem) { return elem.size == size && elem.alignment == alignment; });
+        return (it == range.end()) ? nullptr : it;
+    }
+
+    [[nodiscard]] size_class *assure(const std::size_t size, const std::size_t alignment) noexcept {
+        if(auto *elem = find(size, alignment); elem || used == classes.size()) {
+            return elem;
+        }
+
+        return &(classes[used++] = size_class{size, alignment, mark_for(size), 0u, nullptr});
+    }
+
+    void pop(size_class &elem) noexcept {
+        auto *block = elem.head;
+        elem.head = block->next;
+        --elem.count;
+        cached -= elem.size;
+        deallocate_block(block, elem.alignment);
+    }
+
+    void trim(size_class &elem) noexcept {
+        for(; elem.count > elem.high_water_mark; ++returned) {
+            pop(elem);
+        }
+    }
+
+    [[nodiscard]] std::size_t mark_for(const std::size_t size) const noexcept {
+        const auto it = std::find_if(overrides.cbegin(), overrides.cend(), [size](const auto &elem) { return elem.first == size; });
+        return (it == overrides.cend()) ? mark : it->second;
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Maximum number of size classes tracked by a pool. */
+    static constexpr size_type max_size_classes = 32u;
+
+    /**
+     * @brief Constructs a pool with a given default high-water mark and budget.
+     * @param count Maximum number of blocks cached for each size class.
+     * @param bytes Maximum amount of memory cached overall.
+     */
+    explicit page_pool(const size_type count = 64u, const size_type bytes = 16u * 1024u * 1024u)
+        : classes{},
+          overrides{},
+          used{},
+          mark{count},
+          limit{bytes},
+          cached{},
+          hit{},
+          miss{},
+          returned{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    page_pool(const page_pool &) = delete;
+
+    /*! @brief Default destructor. */
+    ~page_pool() {
+        release();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    page_pool &operator=(const page_pool &) = delete;
+
+    /**
+     * @brief Allocates a block of memory, possibly recycling a cached one.
+     * @param size Size of the block in bytes.
+     * @param alignment Alignment of the block.
+     * @return A pointer to the block.
+     */
+    [[nodiscard]] void *allocate(const size_type size, const size_type alignment) {
+        if(!is_cacheable(size)) {
+            return allocate_block(size, alignment);
+        }
+
+        auto *elem = assure(size, alignment);
+
+        if(!elem) {
+            return allocate_block(size, alignment);
+        }
+
+        if(elem->head) {
+            auto *block = elem->head;
+            elem->head = block->next;
+            --elem->count;
+            cached -= size;
+            ++hit;
+            return block;
+        }
+
+        ++miss;
+        return allocate_block(size, alignment);
+    }
+
+    /**
+     * @brief Returns a block of memory to the pool.
+     *
+     * The block is cached unless its size class already reached the
+     * high-water mark or the pool its budget, in which case it's released
+     * immediately.
+     *
+     * @param ptr A pointer to the block, as returned by `allocate`.
+     * @param size Size of the block in bytes.
+     * @param alignment Alignment of the block.
+     */
+    void deallocate(void *ptr, const size_type size, const size_type alignment) noexcept {
+        if(auto *elem = is_cacheable(size) ? find(size, alignment) : nullptr; elem && elem->count < elem->high_water_mark && !(limit - cached < size)) {
+            elem->head = ::new(ptr) free_block{elem->head};
+            ++elem->count;
+            cached += size;
+        } else {
+            ++returned;
+            deallocate_block(ptr, alignment);
+        }
+    }
+
+    /**
+     * @brief Returns the default high-water mark.
+     * @return Maximum number of blocks cached for each size class.
+     */
+    [[nodiscard]] size_type high_water_mark() const noexcept {
+        return mark;
+    }
+
+    /**
+     * @brief Sets the default high-water mark.
+     *
+     * Size classes without a specific mark are trimmed accordingly.
+     *
+     * @param count Maximum number of blocks cached for each size class.
+     */
+    void high_water_mark(const size_type count) {
+        mark = count;
+
+        for(auto &elem: size_classes()) {
+            elem.high_water_mark = mark_for(elem.size);
+            trim(elem);
+        }
+    }
+
+    /**
+     * @brief Returns the high-water mark for blocks of a given size.
+     * @param size Size of the blocks in bytes.
+     * @return Maximum number of blocks of the given size cached.
+     */
+    [[nodiscard]] size_type high_water_mark_of(const size_type size) const noexcept {
+        return mark_for(size);
+    }
+
+    /**
+     * @brief Sets the high-water mark for blocks of a given size.
+     * @param size Size of the blocks in bytes.
+     * @param count Maximum number of blocks of the given size cached.
+     */
+    void high_water_mark_of(const size_type size, const size_type count) {
+        if(const auto it = std::find_if(overrides.begin(), overrides.end(), [size](const auto &elem) { return elem.first == size; }); it == overrides.end()) {
+            overrides.emplace_back(size, count);
+        } else {
+            it->second = count;
+        }
+
+        for(auto &elem: size_classes()) {
+            if(elem.size == size) {
+                elem.high_water_mark = count;
+                trim(elem);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the maximum amount of memory cached by the pool.
+     * @return Number of bytes the pool can cache.
+     */
+    [[nodiscard]] size_type budget() const noexcept {
+        return limit;
+    }
+
+    /**
+     * @brief Sets the maximum amount of memory cached by the pool.
+     *
+     * Cached blocks exceeding the new budget are released.
+     *
+     * @param bytes Number of bytes the pool can cache.
+     */
+    void budget(const size_type bytes) noexcept {
+        limit = bytes;
+
+        for(auto &elem: size_classes()) {
+            for(; elem.head && limit < cached; ++returned) {
+                pop(elem);
+            }
+        }
+    }
+
+    /*! @brief Releases all the cached blocks. */
+    void release() noexcept {
+        for(auto &elem: size_classes()) {
+            while(elem.head) {
+                pop(elem);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of cached blocks.
+     * @return Number of cached blocks.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        size_type count{};
+
+        for(std::size_t pos{}; pos < used; ++pos) {
+            count += classes[pos].count;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Returns the amount of memory held by the cached blocks.
+     * @return Number of bytes cached.
+     */
+    [[nodiscard]] size_type memory() const noexcept {
+        return cached;
+    }
+
+    /**
+     * @brief Returns the number of allocations served by cached blocks.
+     * @return Number of recycled blocks.
+     */
+    [[nodiscard]] size_type hits() const noexcept {
+        return hit;
+    }
+
+    /**
+     * @brief Returns the number of cacheable allocations that fell through to
+     * the global allocator.
+     * @return Number of fresh blocks.
+     */
+    [[nodiscard]] size_type misses() const noexcept {
+        return miss;
+    }
+
+    /**
+     * @brief Returns the number of blocks given back to the global allocator.
+     * @return Number of released blocks.
+     */
+    [[nodiscard]] size_type released() const noexcept {
+        return returned;
+    }
+
+private:
+    std::array<size_class, max_size_classes> classes;
+    std::vector<std::pair<size_type, size_type>> overrides;
+    size_type used;
+    size_type mark;
+    size_type limit;
+    size_type cached;
+    size_type hit;
+    size_type miss;
+    size_type returned;
+};
+
+/**
+ * @brief Allocator that gets its memory from a page pool.
+ *
+ * A default constructed allocator isn't bound to any pool and forwards all
+ * requests to the global allocator.
+ *
+ * @tparam Type Type of objects to allocate.
+ */
+template<typename Type>
+class page_allocator {
+    template<typename>
+    friend class page_allocator;
+
+public:
+    /*! @brief Type of objects to allocate. */
+    using value_type = Type;
+    /*! @brief Allocators are propagated on move assignment. */
+    using propagate_on_container_move_assignment = std::true_type;
+    /*! @brief Allocators are propagated on swap. */
+    using propagate_on_container_swap = std::true_type;
+
+    /*! @brief Default constructor. */
+    constexpr page_allocator() noexcept
+        : pool{} {}
+
+    /**
+     * @brief Constructs an allocator bound to a given pool.
+     * @param ref A valid reference to a page pool.
+     */
+    constexpr page_allocator(page_pool &ref) noexcept
+        : pool{&ref} {}
+
+    /**
+     * @brief Converting constructor.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @param other The allocator to copy from.
+     */
+    template<typename Other>
+    constexpr page_allocator(const page_allocator<Other> &other) noexcept
+        : pool{other.pool} {}
+
+    /**
+     * @brief Allocates storage for a given number of objects.
+     * @param length Number of objects to allocate storage for.
+     * @return A pointer to the allocated storage.
+     */
+    [[nodiscard]] Type *allocate(const std::size_t length) {
+        ENTT_ASSERT(length <= (std::numeric_limits<std::size_t>::max)() / sizeof(Type), "Invalid length");
+        return static_cast<Type *>(pool ? pool->allocate(length * sizeof(Type), alignof(Type)) : std::allocator<Type>{}.allocate(length));
+    }
+
+    /**
+     * @brief Deallocates storage previously allocated.
+     * @param ptr A pointer to the storage to deallocate.
+     * @param length Number of objects the storage was allocated for.
+     */
+    void deallocate(Type *ptr, const std::size_t length) noexcept {
+        if(pool) {
+            pool->deallocate(ptr, length * sizeof(Type), alignof(Type));
+        } else {
+            std::allocator<Type>{}.deallocate(ptr, length);
+        }
+    }
+
+    /**
+     * @brief Returns the pool the allocator is bound to, if any.
+     * @return A pointer to the page pool, if any.
+     */
+    [[nodiscard]] page_pool *resource() const noexcept {
+        return pool;
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @param other The allocator to compare with.
+     * @return True if the allocators share the same pool, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] constexpr bool operator==(const page_allocator<Other> &other) const noexcept {
+        return pool == other.pool;
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @param other The allocator to compare with.
+     * @return False if the allocators share the same pool, true otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] constexpr bool operator!=(const page_allocator<Other> &other) const noexcept {
+        return !(*this == other);
+    }
+
+private:
+    page_pool *pool;
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,307 @@
+#ifndef ENTT_ENTITY_COMMAND_BUFFER_HPP
+#define ENTT_ENTITY_COMMAND_BUFFER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "../core/utility.hpp"
+#include "component.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+template<typename Registry>
+struct basic_command_pool {
+    virtual ~basic_command_pool() = default;
+    virtual void emplace(Registry &) = 0;
+    virtual void remove(Registry &) = 0;
+    virtual void clear() noexcept = 0;
+    [[nodiscard]] virtual bool empty() const noexcept = 0;
+};
+
+template<typename Registry, typename Type>
+struct command_pool final: basic_command_pool<Registry> {
+    using entity_type = typename Registry::entity_type;
+
+    void emplace(Registry &reg) override {
+        if constexpr(component_traits<Type>::page_size == 0u) {
+            reg.template insert<Type>(created.cbegin(), created.cend());
+        } else {
+            reg.template insert<Type>(created.cbegin(), created.cend(), std::make_move_iterator(value.begin()));
+        }
+    }
+
+    void remove(Registry &reg) override {
+        reg.template remove<Type>(removed.cbegin(), removed.cend());
+    }
+
+    void clear() noexcept override {
+        created.clear();
+        value.clear();
+        removed.clear();
+    }
+
+    [[nodiscard]] bool empty() const noexcept override {
+        return created.empty() && removed.empty();
+    }
+
+    std::vector<entity_type> created;
+    std::vector<Type> value;
+    std::vector<entity_type> removed;
+};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Deferred structural changes for registries.
+ *
+ * Command buffers record the creation and destruction of entities and the
+ * assignment and removal of components from multiple threads, for example
+ * during a parallel iteration. Each thread records its commands in its own
+ * arena, without contention with the others.<br/>
+ * Commands are played back in batches when the buffer is flushed, grouped per
+ * pool. Components are assigned first, then removed and entities are destroyed
+ * last.
+ *
+ * Identifiers returned by a command buffer are reserved up front, therefore
+ * other commands can refer to them. They become valid when the buffer is
+ * flushed.
+ *
+ * @warning
+ * Recording commands and flushing a command buffer concurrently results in
+ * undefined behavior. The same applies to creating or destroying entities
+ * through the registry while there are identifiers reserved.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_command_buffer final {
+    using pool_base_type = internal::basic_command_pool<Registry>;
+
+    template<typename Type>
+    using pool_type = internal::command_pool<Registry, Type>;
+
+    struct arena_type {
+        std::thread::id owner;
+        dense_map<id_type, std::unique_ptr<pool_base_type>, identity> pools;
+        std::vector<typename Registry::entity_type> destroyed;
+    };
+
+    [[nodiscard]] static std::size_t next_serial() noexcept {
+        static std::atomic<std::size_t> counter{};
+        return ++counter;
+    }
+
+    [[nodiscard]] arena_type &local() {
+        // the arena last used by a thread is cached so as not to lock on every command
+        thread_local std::pair<std::size_t, arena_type *> cache{};
+
+        if(cache.first != serial) {
+            const auto id = std::this_thread::get_id();
+            std::lock_guard guard{mutex};
+            auto it = std::find_if(arenas.begin(), arenas.end(), [id](const auto &elem) { return elem->owner == id; });
+
+            if(it == arenas.end()) {
+                it = arenas.insert(arenas.end(), std::make_unique<arena_type>());
+                (*it)->owner = id;
+            }
+
+            cache = {serial, it->get()};
+        }
+
+        return *cache.second;
+    }
+
+    template<typename Type>
+    [[nodiscard]] pool_type<Type> &assure() {
+        auto &pools = local().pools;
+        auto &elem = pools[type_hash<Type>::value()];
+
+        if(!elem) {
+            elem = std::make_unique<pool_type<Type>>();
+        }
+
+        return static_cast<pool_type<Type> &>(*elem);
+    }
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a command buffer for a given registry.
+     * @param reg A valid registry.
+     */
+    explicit basic_command_buffer(registry_type &reg)
+        : owner{&reg},
+          arenas{},
+          mutex{},
+          serial{next_serial()} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_command_buffer(const basic_command_buffer &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_command_buffer(basic_command_buffer &&) = delete;
+
+    /*! @brief Default destructor. */
+    ~basic_command_buffer() noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This command buffer.
+     */
+    basic_command_buffer &operator=(const basic_command_buffer &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This command buffer.
+     */
+    basic_command_buffer &operator=(basic_command_buffer &&) = delete;
+
+    /**
+     * @brief Returns the registry of a command buffer.
+     * @return A reference to the registry of the command buffer.
+     */
+    [[nodiscard]] registry_type &registry() const noexcept {
+        return *owner;
+    }
+
+    /**
+     * @brief Reserves an identifier for a new entity.
+     *
+     * Identifiers are reserved atomically from the storage of the entities and
+     * become valid once the command buffer is flushed.
+     *
+     * @return An identifier that is valid after the next flush.
+     */
+    [[nodiscard]] entity_type create() {
+        return owner->template storage<entity_type>().reserve_atomic();
+    }
+
+    /**
+     * @brief Records the assignment of a component to an entity.
+     *
+     * @warning
+     * Assigning the same component to an entity twice, either from the
+     * buffer or from the registry, results in undefined behavior.
+     *
+     * @tparam Type Type of component to create.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to initialize the component.
+     */
+    template<typename Type, typename... Args>
+    void emplace(const entity_type entt, Args &&...args) {
+        auto &cpool = assure<Type>();
+        cpool.created.push_back(entt);
+
+        if constexpr(component_traits<Type>::page_size != 0u) {
+            if constexpr(std::is_aggregate_v<Type>) {
+                cpool.value.push_back(Type{std::forward<Args>(args)...});
+            } else {
+                cpool.value.emplace_back(std::forward<Args>(args)...);
+            }
+        }
+    }
+
+    /**
+     * @brief Records the removal of the given components from an entity.
+     * @tparam Type Types of components to remove.
+     * @param entt A valid identifier.
+     */
+    template<typename... Type>
+    void remove(const entity_type entt) {
+        (assure<Type>().removed.push_back(entt), ...);
+    }
+
+    /**
+     * @brief Records the destruction of an entity.
+     *
+     * @warning
+     * Destroying the same entity twice results in undefined behavior.
+     *
+     * @param entt A valid identifier.
+     */
+    void destroy(const entity_type entt) {
+        local().destroyed.push_back(entt);
+    }
+
+    /**
+     * @brief Checks if a command buffer has commands to play back.
+     * @return True if the command buffer has no commands, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return std::all_of(arenas.cbegin(), arenas.cend(), [](const auto &arena) {
+            return arena->destroyed.empty() && std::all_of(arena->pools.cbegin(), arena->pools.cend(), [](const auto &elem) { return elem.second->empty(); });
+        });
+    }
+
+    /**
+     * @brief Plays back all commands and clears the command buffer.
+     *
+     * Arenas retain their memory, so that recording the same commands again
+     * doesn't allocate.
+     *
+     * @warning
+     * This function isn't thread safe and must not be invoked while recording.
+     */
+    void flush() {
+        owner->template storage<entity_type>().commit_reserved();
+
+        for(auto &&arena: arenas) {
+            for(auto &&elem: arena->pools) {
+                elem.second->emplace(*owner);
+            }
+        }
+
+        for(auto &&arena: arenas) {
+            for(auto &&elem: arena->pools) {
+                elem.second->remove(*owner);
+                elem.second->clear();
+            }
+        }
+
+        for(auto &&arena: arenas) {
+            owner->destroy(arena->destroyed.cbegin(), arena->destroyed.cend());
+            arena->destroyed.clear();
+        }
+    }
+
+private:
+    registry_type *owner;
+    std::vector<std::unique_ptr<arena_type>> arenas;
+    std::mutex mutex;
+    std::size_t serial;
+};
+
+} // namespace entt
+
+#endif
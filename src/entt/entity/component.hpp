@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <type_traits>
 #include "../config/config.h"
+#include "../core/type_traits.hpp"
 #include "fwd.hpp"
 
 namespace entt {
@@ -35,6 +36,20 @@ template<typename Type>
 struct page_size<Type, std::enable_if_t<std::is_convertible_v<decltype(Type::page_size), std::size_t>>>
     : std::integral_constant<std::size_t, Type::page_size> {};
 
+template<typename Type, typename = void>
+struct contiguous: std::false_type {};
+
+template<typename Type>
+struct contiguous<Type, std::enable_if_t<Type::contiguous>>
+    : std::true_type {};
+
+template<typename Type, typename = void>
+struct soa_members: type_identity<value_list<>> {};
+
+template<typename Type>
+struct soa_members<Type, std::void_t<typename Type::soa_members>>
+    : type_identity<typename Type::soa_members> {};
+
 } // namespace internal
 
 /**
@@ -57,6 +72,10 @@ struct component_traits {
     static constexpr bool in_place_delete = internal::in_place_delete<Type>::value;
     /*! @brief Page size, default is `ENTT_PACKED_PAGE` for non-empty types. */
     static constexpr std::size_t page_size = internal::page_size<Type>::value;
+    /*! @brief Single block payload, default is `false`. */
+    static constexpr bool contiguous = internal::contiguous<Type>::value;
+    /*! @brief Data members to split over separate arrays, default is none. */
+    using soa_members = typename internal::soa_members<Type>::type;
 };
 
 } // namespace entt
@@ -81,12 +81,21 @@ class basic_runtime_view;
 template<typename, typename, typename>
 class basic_group;
 
+template<typename, typename>
+class basic_owning_view;
+
 template<typename, typename Mask = std::uint32_t, typename = std::allocator<Mask>>
 class basic_observer;
 
 template<typename>
 class basic_organizer;
 
+template<typename>
+class basic_job_system;
+
+template<typename>
+class basic_command_buffer;
+
 template<typename, typename...>
 struct basic_handle;
 
@@ -202,6 +211,12 @@ using observer = basic_observer<registry>;
 /*! @brief Alias declaration for the most common use case. */
 using organizer = basic_organizer<registry>;
 
+/*! @brief Alias declaration for the most common use case. */
+using job_system = basic_job_system<registry>;
+
+/*! @brief Alias declaration for the most common use case. */
+using command_buffer = basic_command_buffer<registry>;
+
 /*! @brief Alias declaration for the most common use case. */
 using handle = basic_handle<registry>;
 
@@ -254,6 +269,14 @@ using const_runtime_view = basic_runtime_view<const sparse_set>;
 template<typename Owned, typename Get, typename Exclude>
 using group = basic_group<type_list_transform_t<Owned, storage_for>, type_list_transform_t<Get, storage_for>, type_list_transform_t<Exclude, storage_for>>;
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Owned Types of storage _owned_ by the view.
+ * @tparam Exclude Types of storage used to filter the view.
+ */
+template<typename Owned, typename Exclude = exclude_t<>>
+using owning_view = basic_owning_view<type_list_transform_t<Owned, storage_for>, type_list_transform_t<Exclude, storage_for>>;
+
 } // namespace entt
 
 #endif
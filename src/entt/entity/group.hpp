@@ -1,10 +1,13 @@
 #ifndef ENTT_ENTITY_GROUP_HPP
 #define ENTT_ENTITY_GROUP_HPP
 
+#include <algorithm>
+#include <iterator>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include "../config/config.h"
+#include "../core/algorithm.hpp"
 #include "../core/fwd.hpp"
 #include "../core/iterator.hpp"
 #include "../core/type_info.hpp"
@@ -32,8 +35,11 @@ class extended_group_iterator<It, owned_t<Owned...>, get_t<Get...>> {
     auto index_to_element([[maybe_unused]] Type &cpool) const {
         if constexpr(Type::traits_type::page_size == 0u) {
             return std::make_tuple();
-        } else {
+        } else if constexpr(std::is_reference_v<decltype(cpool.rbegin()[it.index()])>) {
             return std::forward_as_tuple(cpool.rbegin()[it.index()]);
+        } else {
+            // proxy tuples are flattened the same way get_as_tuple does
+            return cpool.rbegin()[it.index()];
         }
     }
 
@@ -92,19 +98,38 @@ template<typename... Lhs, typename... Rhs>
     return !(lhs == rhs);
 }
 
+template<typename Entity>
 struct group_descriptor {
     using size_type = std::size_t;
     virtual ~group_descriptor() = default;
     virtual size_type owned(const id_type *, const size_type) const noexcept {
         return 0u;
     }
+    virtual bool wider(const id_type *, const size_type, const size_type, const size_type) const noexcept {
+        return false;
+    }
+    virtual bool narrower(const id_type *, const size_type, const size_type, const size_type) const noexcept {
+        return false;
+    }
+    virtual void release() noexcept {}
+    virtual void push(const Entity) {}
+    virtual void pop(const Entity) {}
+    virtual void disable(const Entity) {}
+    virtual void enable(const Entity) {}
+    // nested groups form a chain, from the least to the most restrictive one
+    group_descriptor *parent{};
+    group_descriptor *child{};
 };
 
+[[nodiscard]] inline bool group_contains(const id_type *first, const id_type *last, const id_type elem) noexcept {
+    return std::find(first, last, elem) != last;
+}
+
 template<typename, typename, typename>
 class group_handler;
 
 template<typename... Owned, typename... Get, typename... Exclude>
-class group_handler<owned_t<Owned...>, get_t<Get...>, exclude_t<Exclude...>> final: public group_descriptor {
+class group_handler<owned_t<Owned...>, get_t<Get...>, exclude_t<Exclude...>> final: public group_descriptor<typename std::common_type_t<typename Owned::base_type..., typename Get::base_type..., typename Exclude::base_type...>::entity_type> {
     // nasty workaround for an issue with the toolset v141 that doesn't accept a fold expression here
     static_assert(!std::disjunction_v<std::bool_constant<Owned::traits_type::in_place_delete>...>, "Groups do not support in-place delete");
     static_assert(!std::disjunction_v<std::is_const<Owned>..., std::is_const<Get>..., std::is_const<Exclude>...>, "Const storage type not allowed");
@@ -116,23 +141,35 @@ class group_handler<owned_t<Owned...>, get_t<Get...>, exclude_t<Exclude...>> fin
         std::apply([pos, entt](auto *...cpool) { (cpool->swap_elements(cpool->data()[pos], entt), ...); }, pools);
     }
 
+    template<std::size_t... Index>
+    [[nodiscard]] bool owned_enabled(std::index_sequence<Index...>) const noexcept {
+        return ((std::get<Index>(pools)->disabled() == 0u) && ...);
+    }
+
     void push_on_construct(const entity_type entt) {
+        ENTT_ASSERT(owned_enabled(std::index_sequence_for<Owned...>{}), "Disabled entities cannot be owned");
+
         if(std::apply([entt, len = len](auto *cpool, auto *...other) { return cpool->contains(entt) && !(cpool->index(entt) < len) && (other->contains(entt) && ...); }, pools)
            && std::apply([entt](auto *...cpool) { return (!cpool->contains(entt) && ...); }, filter)) {
-            swap_elements(len++, entt);
+            push(entt);
         }
     }
 
     void push_on_destroy(const entity_type entt) {
         if(std::apply([entt, len = len](auto *cpool, auto *...other) { return cpool->contains(entt) && !(cpool->index(entt) < len) && (other->contains(entt) && ...); }, pools)
            && std::apply([entt](auto *...cpool) { return (0u + ... + cpool->contains(entt)) == 1u; }, filter)) {
-            swap_elements(len++, entt);
+            push(entt);
         }
     }
 
     void remove_if(const entity_type entt) {
-        if(std::get<0>(pools)->contains(entt) && (std::get<0>(pools)->index(entt) < len)) {
-            swap_elements(--len, entt);
+        pop(entt);
+    }
+
+    template<void (group_handler::*Member)(const entity_type)>
+    void for_each(const entity_type *first, const entity_type *last) {
+        for(; first != last; ++first) {
+            (this->*Member)(*first);
         }
     }
 
@@ -143,8 +180,8 @@ public:
         : pools{&opool..., &gpool...},
           filter{&epool...},
           len{} {
-        std::apply([this](auto *...cpool) { ((cpool->on_construct().template connect<&group_handler::push_on_construct>(*this), cpool->on_destroy().template connect<&group_handler::remove_if>(*this)), ...); }, pools);
-        std::apply([this](auto *...cpool) { ((cpool->on_construct().template connect<&group_handler::remove_if>(*this), cpool->on_destroy().template connect<&group_handler::push_on_destroy>(*this)), ...); }, filter);
+        std::apply([this](auto *...cpool) { ((cpool->on_construct_range().template connect<&group_handler::for_each<&group_handler::push_on_construct>>(*this), cpool->on_destroy_range().template connect<&group_handler::for_each<&group_handler::remove_if>>(*this)), ...); }, pools);
+        std::apply([this](auto *...cpool) { ((cpool->on_construct_range().template connect<&group_handler::for_each<&group_handler::remove_if>>(*this), cpool->on_destroy_range().template connect<&group_handler::for_each<&group_handler::push_on_destroy>>(*this)), ...); }, filter);
 
         // we cannot iterate backwards because we want to leave behind valid entities in case of owned types
         for(auto *first = std::get<0>(pools)->data(), *last = first + std::get<0>(pools)->size(); first != last; ++first) {
@@ -162,6 +199,49 @@ public:
         return cnt;
     }
 
+    bool wider(const id_type *elem, const size_type olen, const size_type glen, const size_type elen) const noexcept final {
+        // all the entities of the other group belong to this one, which owns a subset of its pools
+        [[maybe_unused]] const auto *get = elem + olen;
+        [[maybe_unused]] const auto *last = get + glen;
+        return (group_contains(elem, get, entt::type_hash<typename Owned::value_type>::value()) && ...)
+               && (group_contains(elem, last, entt::type_hash<typename Get::value_type>::value()) && ...)
+               && (group_contains(last, last + elen, entt::type_hash<typename Exclude::value_type>::value()) && ...);
+    }
+
+    bool narrower(const id_type *elem, const size_type olen, const size_type glen, const size_type elen) const noexcept final {
+        // all the entities of this group belong to the other one, which owns a subset of its pools
+        const id_type local[]{entt::type_hash<typename Owned::value_type>::value()..., entt::type_hash<typename Get::value_type>::value()..., entt::type_hash<typename Exclude::value_type>::value()...};
+        const auto *lget = local + sizeof...(Owned);
+        const auto *llast = lget + sizeof...(Get);
+        const auto *get = elem + olen;
+        const auto *last = get + glen;
+        return std::all_of(elem, get, [&local, lget](const auto curr) { return group_contains(local, lget, curr); })
+               && std::all_of(get, last, [&local, llast](const auto curr) { return group_contains(local, llast, curr); })
+               && std::all_of(last, last + elen, [llast, &local](const auto curr) { return group_contains(llast, std::end(local), curr); });
+    }
+
+    void push(const entity_type entt) final {
+        if(!(std::get<0>(pools)->index(entt) < len)) {
+            // wider groups must contain the entity before it enters their nested prefix
+            this->parent ? this->parent->push(entt) : void();
+            swap_elements(len++, entt);
+        }
+    }
+
+    void pop(const entity_type entt) final {
+        if(std::get<0>(pools)->contains(entt) && (std::get<0>(pools)->index(entt) < len)) {
+            // narrower groups must release the entity before it leaves the prefix
+            this->child ? this->child->pop(entt) : void();
+            swap_elements(--len, entt);
+        }
+    }
+
+    void disconnect() {
+        std::apply([this](auto *...cpool) { ((cpool->on_construct_range().disconnect(this), cpool->on_destroy_range().disconnect(this)), ...); }, pools);
+        std::apply([this](auto *...cpool) { ((cpool->on_construct_range().disconnect(this), cpool->on_destroy_range().disconnect(this)), ...); }, filter);
+        len = 0u;
+    }
+
     [[nodiscard]] size_type length() const noexcept {
         return len;
     }
@@ -183,7 +263,7 @@ private:
 };
 
 template<typename... Get, typename... Exclude>
-class group_handler<owned_t<>, get_t<Get...>, exclude_t<Exclude...>> final: public group_descriptor {
+class group_handler<owned_t<>, get_t<Get...>, exclude_t<Exclude...>> final: public group_descriptor<typename std::common_type_t<typename Get::base_type..., typename Exclude::base_type...>::entity_type> {
     // nasty workaround for an issue with the toolset v141 that doesn't accept a fold expression here
     static_assert(!std::disjunction_v<std::is_const<Get>..., std::is_const<Exclude>...>, "Const storage type not allowed");
 
@@ -191,8 +271,9 @@ class group_handler<owned_t<>, get_t<Get...>, exclude_t<Exclude...>> final: publ
     using entity_type = typename base_type::entity_type;
 
     void push_on_construct(const entity_type entt) {
+        // disabled entities don't belong to non-owning groups until they're enabled again
         if(!elem.contains(entt)
-           && std::apply([entt](auto *...cpool) { return (cpool->contains(entt) && ...); }, pools)
+           && std::apply([entt](auto *...cpool) { return (cpool->enabled(entt) && ...); }, pools)
            && std::apply([entt](auto *...cpool) { return (!cpool->contains(entt) && ...); }, filter)) {
             elem.push(entt);
         }
@@ -200,7 +281,7 @@ class group_handler<owned_t<>, get_t<Get...>, exclude_t<Exclude...>> final: publ
 
     void push_on_destroy(const entity_type entt) {
         if(!elem.contains(entt)
-           && std::apply([entt](auto *...cpool) { return (cpool->contains(entt) && ...); }, pools)
+           && std::apply([entt](auto *...cpool) { return (cpool->enabled(entt) && ...); }, pools)
            && std::apply([entt](auto *...cpool) { return (0u + ... + cpool->contains(entt)) == 1u; }, filter)) {
             elem.push(entt);
         }
@@ -210,6 +291,13 @@ class group_handler<owned_t<>, get_t<Get...>, exclude_t<Exclude...>> final: publ
         elem.remove(entt);
     }
 
+    template<void (group_handler::*Member)(const entity_type)>
+    void for_each(const entity_type *first, const entity_type *last) {
+        for(; first != last; ++first) {
+            (this->*Member)(*first);
+        }
+    }
+
 public:
     using common_type = base_type;
 
@@ -218,14 +306,22 @@ public:
         : pools{&gpool...},
           filter{&epool...},
           elem{alloc} {
-        std::apply([this](auto *...cpool) { ((cpool->on_construct().template connect<&group_handler::push_on_construct>(*this), cpool->on_destroy().template connect<&group_handler::remove_if>(*this)), ...); }, pools);
-        std::apply([this](auto *...cpool) { ((cpool->on_construct().template connect<&group_handler::remove_if>(*this), cpool->on_destroy().template connect<&group_handler::push_on_destroy>(*this)), ...); }, filter);
+        std::apply([this](auto *...cpool) { ((cpool->on_construct_range().template connect<&group_handler::for_each<&group_handler::push_on_construct>>(*this), cpool->on_destroy_range().template connect<&group_handler::for_each<&group_handler::remove_if>>(*this)), ...); }, pools);
+        std::apply([this](auto *...cpool) { ((cpool->on_construct_range().template connect<&group_handler::for_each<&group_handler::remove_if>>(*this), cpool->on_destroy_range().template connect<&group_handler::for_each<&group_handler::push_on_destroy>>(*this)), ...); }, filter);
 
         for(const auto entity: static_cast<base_type &>(*std::get<0>(pools))) {
             push_on_construct(entity);
         }
     }
 
+    void disable(const entity_type entt) final {
+        remove_if(entt);
+    }
+
+    void enable(const entity_type entt) final {
+        push_on_construct(entt);
+    }
+
     common_type &handle() noexcept {
         return elem;
     }
@@ -560,6 +656,47 @@ public:
         }
     }
 
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The entities of the group are split in chunks that never straddle a page
+     * and the chunks are spread over the workers of the given executor. The
+     * function object is invoked concurrently, therefore it must be safe to do
+     * so.
+     *
+     * @warning
+     * Only reading and modifying the components in place is allowed during
+     * iterations. Creating or destroying entities and components, as well as
+     * sorting, results in undefined behavior.
+     *
+     * @sa each
+     * @sa is_executor
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param exec A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    std::enable_if_t<is_executor_v<Executor>> each(Executor &&exec, Func func) const {
+        if(*this) {
+            [[maybe_unused]] const auto len = size();
+
+            internal::for_each_page(exec, 0u, len, ENTT_PACKED_PAGE, [this, &func](const std::size_t from, const std::size_t to) {
+                for(auto first = end() - static_cast<std::ptrdiff_t>(to), last = end() - static_cast<std::ptrdiff_t>(from); first != last; ++first) {
+                    if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_group>().get({})))>) {
+                        std::apply(func, std::tuple_cat(std::make_tuple(*first), get(*first)));
+                    } else {
+                        std::apply(func, get(*first));
+                    }
+                }
+            });
+
+            ENTT_ASSERT(len == size(), "Structural changes are not allowed");
+        }
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ a group.
      *
@@ -955,6 +1092,51 @@ public:
         }
     }
 
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The entities of the group are split in chunks that never straddle a page
+     * and the chunks are spread over the workers of the given executor. The
+     * function object is invoked concurrently, therefore it must be safe to do
+     * so.
+     *
+     * @warning
+     * Only reading and modifying the components in place is allowed during
+     * iterations. Creating or destroying entities and components, as well as
+     * sorting, results in undefined behavior.
+     *
+     * @sa each
+     * @sa is_executor
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param exec A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    std::enable_if_t<is_executor_v<Executor>> each(Executor &&exec, Func func) const {
+        if(*this) {
+            using leading_type = type_list_element_t<0u, type_list<Owned...>>;
+            constexpr std::size_t page = (leading_type::traits_type::page_size == 0u) ? ENTT_PACKED_PAGE : leading_type::traits_type::page_size;
+            [[maybe_unused]] const auto len = size();
+
+            internal::for_each_page(exec, 0u, len, page, [this, &func](const std::size_t from, const std::size_t to) {
+                const auto cpools = pools();
+
+                for(auto args: iterable{{end() - static_cast<std::ptrdiff_t>(to), cpools}, {end() - static_cast<std::ptrdiff_t>(from), cpools}}) {
+                    if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_group>().get({})))>) {
+                        std::apply(func, args);
+                    } else {
+                        std::apply([&func](auto, auto &&...less) { func(std::forward<decltype(less)>(less)...); }, args);
+                    }
+                }
+            });
+
+            ENTT_ASSERT(len == size(), "Structural changes are not allowed");
+        }
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ a group.
      *
@@ -1008,7 +1190,7 @@ public:
      * @param args Arguments to forward to the sort function object, if any.
      */
     template<typename Type, typename... Other, typename Compare, typename Sort = std_sort, typename... Args>
-    void sort(Compare compare, Sort algo = Sort{}, Args &&...args) const {
+    std::enable_if_t<!is_executor_v<Compare>> sort(Compare compare, Sort algo = Sort{}, Args &&...args) const {
         sort<index_of<Type>, index_of<Other>...>(std::move(compare), std::move(algo), std::forward<Args>(args)...);
     }
 
@@ -1026,7 +1208,8 @@ public:
      * @param args Arguments to forward to the sort function object, if any.
      */
     template<std::size_t... Index, typename Compare, typename Sort = std_sort, typename... Args>
-    void sort(Compare compare, Sort algo = Sort{}, Args &&...args) const {
+    std::enable_if_t<!is_executor_v<Compare>> sort(Compare compare, Sort algo = Sort{}, Args &&...args) const {
+        ENTT_ASSERT(descriptor->child == nullptr, "Cannot sort a group with nested groups");
         const auto cpools = pools();
 
         if constexpr(sizeof...(Index) == 0) {
@@ -1055,6 +1238,84 @@ public:
         std::apply(cb, cpools);
     }
 
+    /**
+     * @brief Sort a group according to the given comparison function, in
+     * parallel.
+     *
+     * @sa sort
+     * @sa basic_sparse_set::sort_n
+     *
+     * @tparam Type Optional type of component to compare.
+     * @tparam Other Other optional types of components to compare.
+     * @tparam Executor Type of executor.
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param exec A valid executor.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Type, typename... Other, typename Executor, typename Compare, typename Sort = parallel_sort, typename... Args>
+    std::enable_if_t<is_executor_v<Executor>> sort(Executor &&exec, Compare compare, Sort algo = Sort{}, Args &&...args) const {
+        sort<index_of<Type>, index_of<Other>...>(exec, std::move(compare), std::move(algo), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Sort a group according to the given comparison function, in
+     * parallel.
+     *
+     * @sa sort
+     *
+     * @tparam Index Optional indexes of components to compare.
+     * @tparam Executor Type of executor.
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param exec A valid executor.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<std::size_t... Index, typename Executor, typename Compare, typename Sort = parallel_sort, typename... Args>
+    std::enable_if_t<is_executor_v<Executor>> sort(Executor &&exec, Compare compare, Sort algo = Sort{}, Args &&...args) const {
+        ENTT_ASSERT(descriptor->child == nullptr, "Cannot sort a group with nested groups");
+        const auto cpools = pools();
+
+        if constexpr(sizeof...(Index) == 0) {
+            static_assert(std::is_invocable_v<Compare, const entity_type, const entity_type>, "Invalid comparison function");
+            storage<0>()->sort_n(exec, descriptor->length(), std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        } else {
+            auto comp = [&compare, &cpools](const entity_type lhs, const entity_type rhs) {
+                if constexpr(sizeof...(Index) == 1) {
+                    return compare((std::get<Index>(cpools)->get(lhs), ...), (std::get<Index>(cpools)->get(rhs), ...));
+                } else {
+                    return compare(std::forward_as_tuple(std::get<Index>(cpools)->get(lhs)...), std::forward_as_tuple(std::get<Index>(cpools)->get(rhs)...));
+                }
+            };
+
+            storage<0>()->sort_n(exec, descriptor->length(), std::move(comp), std::move(algo), std::forward<Args>(args)...);
+        }
+
+        auto cb = [this, &exec](auto *head, auto *...other) {
+            [[maybe_unused]] auto arrange = [this, &exec, head](auto *cpool) {
+                if constexpr(type_list_contains_v<type_list<Owned...>, std::remove_pointer_t<decltype(cpool)>>) {
+                    // owned pools already have the entities of the group in front
+                    cpool->sort_n(exec, descriptor->length(), [head](const entity_type lhs, const entity_type rhs) { return head->index(lhs) > head->index(rhs); });
+                } else {
+                    for(auto next = descriptor->length(); next; --next) {
+                        const auto pos = next - 1;
+                        cpool->swap_elements(cpool->data()[pos], head->data()[pos]);
+                    }
+                }
+            };
+
+            (arrange(other), ...);
+        };
+
+        std::apply(cb, cpools);
+    }
+
 private:
     handler *descriptor;
 };
@@ -0,0 +1,320 @@
+#ifndef ENTT_ENTITY_JOB_SYSTEM_HPP
+#define ENTT_ENTITY_JOB_SYSTEM_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "fwd.hpp"
+#include "organizer.hpp"
+
+namespace entt {
+
+/**
+ * @brief Work stealing job system for task graphs.
+ *
+ * This class runs the graphs generated by an organizer to completion. Each
+ * worker has its own queue of ready tasks and steals from the others when it
+ * runs out of work. The calling thread also participates in the execution.<br/>
+ * Tasks are launched as soon as all their predecessors are completed, those
+ * with the highest priority first. When no worker threads are requested, the
+ * graph is executed on the calling thread only.
+ *
+ * @warning
+ * Tasks aren't allowed to throw exceptions when executed on worker threads.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_job_system final {
+    using organizer_type = basic_organizer<Registry>;
+
+    struct queue_type {
+        std::mutex mutex;
+        std::deque<std::size_t> jobs;
+    };
+
+    void push(const std::size_t self, const std::size_t job) {
+        {
+            std::lock_guard guard{queue[self].mutex};
+            queued.fetch_add(1u, std::memory_order_acq_rel);
+            queue[self].jobs.push_back(job);
+        }
+
+        std::lock_guard guard{mutex};
+        cv.notify_one();
+    }
+
+    [[nodiscard]] bool pop(const std::size_t self, std::size_t &job) {
+        // local jobs are taken from the back, stolen ones from the front
+        for(std::size_t next{}; next < count; ++next) {
+            auto &curr = queue[(self + next) % count];
+            std::lock_guard guard{curr.mutex};
+
+            if(!curr.jobs.empty()) {
+                if(next == 0u) {
+                    job = curr.jobs.back();
+                    curr.jobs.pop_back();
+                } else {
+                    job = curr.jobs.front();
+                    curr.jobs.pop_front();
+                }
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void refresh() {
+        const auto compare = [this](const auto lhs, const auto rhs) { return tasks[lhs].priority() < tasks[rhs].priority(); };
+        successors.resize(tasks.size());
+        roots.clear();
+
+        // ready tasks are pushed in order of priority and popped in reverse order
+        for(std::size_t pos{}, last = tasks.size(); pos < last; ++pos) {
+            if(tasks[pos].top_level()) {
+                roots.push_back(pos);
+            }
+
+            successors[pos].assign(tasks[pos].children().cbegin(), tasks[pos].children().cend());
+            std::sort(successors[pos].begin(), successors[pos].end(), compare);
+        }
+
+        std::sort(roots.begin(), roots.end(), compare);
+    }
+
+    [[nodiscard]] bool execute(const std::size_t self) {
+        std::size_t job{};
+
+        if(!pop(self, job)) {
+            return false;
+        }
+
+        queued.fetch_sub(1u, std::memory_order_acq_rel);
+        auto &node = tasks[job];
+
+        if(factor == 0.) {
+            node.callback()(node.data(), *owner);
+        } else {
+            const auto from = std::chrono::steady_clock::now();
+            node.callback()(node.data(), *owner);
+            const auto elapsed = std::chrono::duration<double, std::micro>{std::chrono::steady_clock::now() - from}.count();
+            node.cost((samples == 0u) ? elapsed : (node.cost() + factor * (elapsed - node.cost())));
+        }
+
+        for(auto child: successors[job]) {
+            if(pending[child].fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
+                push(self, child);
+            }
+        }
+
+        if(remaining.fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
+            std::lock_guard guard{mutex};
+            cv.notify_all();
+        }
+
+        return true;
+    }
+
+    void work(const std::size_t self) {
+        while(true) {
+            if(!execute(self)) {
+                std::unique_lock lock{mutex};
+                cv.wait(lock, [this]() { return stop || (queued.load(std::memory_order_acquire) != 0u); });
+
+                if(stop) {
+                    return;
+                }
+            }
+        }
+    }
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Vertex type of a task graph. */
+    using vertex_type = typename organizer_type::vertex;
+
+    /*! @brief Default constructor, one worker per hardware thread. */
+    basic_job_system()
+        : basic_job_system{std::vector<vertex_type>{}} {}
+
+    /**
+     * @brief Constructs a job system for a given task graph.
+     * @param graph A task graph, as returned by an organizer.
+     * @param workers Number of worker threads besides the calling one.
+     */
+    explicit basic_job_system(std::vector<vertex_type> graph, const size_type workers = (std::max)(std::thread::hardware_concurrency(), 1u) - 1u)
+        : tasks{},
+          pending{},
+          successors{},
+          roots{},
+          queue{std::make_unique<queue_type[]>(workers + 1u)},
+          threads{},
+          mutex{},
+          cv{},
+          owner{},
+          queued{},
+          remaining{},
+          factor{},
+          samples{},
+          count{workers + 1u},
+          stop{} {
+        assign(std::move(graph));
+        threads.reserve(workers);
+
+        for(size_type pos{}; pos < workers; ++pos) {
+            threads.emplace_back(&basic_job_system::work, this, pos);
+        }
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_job_system(const basic_job_system &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_job_system(basic_job_system &&) = delete;
+
+    /*! @brief Stops and joins the worker threads. */
+    ~basic_job_system() {
+        {
+            std::lock_guard guard{mutex};
+            stop = true;
+            cv.notify_all();
+        }
+
+        for(auto &&elem: threads) {
+            elem.join();
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This job system.
+     */
+    basic_job_system &operator=(const basic_job_system &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This job system.
+     */
+    basic_job_system &operator=(basic_job_system &&) = delete;
+
+    /**
+     * @brief Replaces the task graph of a job system.
+     *
+     * @warning
+     * Replacing the task graph during a run results in undefined behavior.
+     *
+     * @param graph A task graph, as returned by an organizer.
+     */
+    void assign(std::vector<vertex_type> graph) {
+        tasks = std::move(graph);
+        pending = std::make_unique<std::atomic<size_type>[]>(tasks.size());
+        samples = 0u;
+        refresh();
+    }
+
+    /**
+     * @brief Enables or disables the recording of the costs of the tasks.
+     *
+     * When enabled, the cost of each vertex is updated after every run with
+     * the exponential moving average of its measured durations, in
+     * microseconds. Priorities are updated accordingly.
+     *
+     * @param value Smoothing factor in the range `(0, 1]`, zero to disable the
+     * recording.
+     */
+    void record(const double value) {
+        ENTT_ASSERT(!(value < 0.) && !(value > 1.), "Invalid smoothing factor");
+        factor = value;
+        samples = 0u;
+    }
+
+    /**
+     * @brief Returns the task graph of a job system.
+     * @return The task graph of the job system.
+     */
+    [[nodiscard]] const std::vector<vertex_type> &graph() const noexcept {
+        return tasks;
+    }
+
+    /**
+     * @brief Returns the number of workers, calling thread included.
+     * @return The number of workers.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return count;
+    }
+
+    /**
+     * @brief Runs the task graph to completion.
+     *
+     * All vertices are prepared for the given registry before running the
+     * tasks, so that no resource is created concurrently. The function returns
+     * when all tasks are completed.
+     *
+     * @param reg A valid registry.
+     */
+    void run(registry_type &reg) {
+        for(auto &&node: tasks) {
+            node.prepare(reg);
+        }
+
+        owner = &reg;
+        remaining.store(tasks.size(), std::memory_order_release);
+
+        for(size_type pos{}, last = tasks.size(); pos < last; ++pos) {
+            pending[pos].store(tasks[pos].predecessors().size(), std::memory_order_relaxed);
+        }
+
+        for(size_type pos{}, last = roots.size(); pos < last; ++pos) {
+            push(pos % count, roots[pos]);
+        }
+
+        while(remaining.load(std::memory_order_acquire) != 0u) {
+            if(!execute(count - 1u)) {
+                std::unique_lock lock{mutex};
+                cv.wait(lock, [this]() { return (queued.load(std::memory_order_acquire) != 0u) || (remaining.load(std::memory_order_acquire) == 0u); });
+            }
+        }
+
+        if(factor != 0.) {
+            ++samples;
+            organizer_type::prioritize(tasks);
+            refresh();
+        }
+    }
+
+private:
+    std::vector<vertex_type> tasks;
+    std::unique_ptr<std::atomic<size_type>[]> pending;
+    std::vector<std::vector<size_type>> successors;
+    std::vector<size_type> roots;
+    std::unique_ptr<queue_type[]> queue;
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable cv;
+    registry_type *owner;
+    std::atomic<size_type> queued;
+    std::atomic<size_type> remaining;
+    double factor;
+    size_type samples;
+    size_type count;
+    bool stop;
+};
+
+} // namespace entt
+
+#endif
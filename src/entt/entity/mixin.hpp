@@ -3,6 +3,7 @@
 
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
 #include "../core/any.hpp"
 #include "../signal/sigh.hpp"
@@ -20,7 +21,13 @@ namespace entt {
  * void(basic_registry<entity_type> &, entity_type);
  * @endcode
  *
- * This applies to all signals made available.
+ * This applies to all signals made available, with the exception of range
+ * signals. These are published once per batch and their listeners receive the
+ * whole set of entities involved at once:
+ *
+ * @code{.cpp}
+ * void(basic_registry<entity_type> &, const entity_type *, const entity_type *);
+ * @endcode
  *
  * @tparam Type The type of the underlying storage.
  */
@@ -29,15 +36,57 @@ class sigh_mixin final: public Type {
     using underlying_type = Type;
     using basic_registry_type = basic_registry<typename underlying_type::entity_type, typename underlying_type::base_type::allocator_type>;
     using sigh_type = sigh<void(basic_registry_type &, const typename underlying_type::entity_type), typename underlying_type::allocator_type>;
+    using range_sigh_type = sigh<void(basic_registry_type &, const typename underlying_type::entity_type *, const typename underlying_type::entity_type *), typename underlying_type::allocator_type>;
     using underlying_iterator = typename underlying_type::base_type::basic_iterator;
+    using entity_container_type = std::vector<typename underlying_type::entity_type, typename underlying_type::base_type::allocator_type>;
 
     basic_registry_type &owner_or_assert() const noexcept {
         ENTT_ASSERT(owner != nullptr, "Invalid pointer to registry");
         return *owner;
     }
 
+    template<typename It>
+    void disable_if_required(const basic_registry_type &reg, It first, It last) {
+        if constexpr(!std::is_same_v<typename underlying_type::value_type, typename underlying_type::entity_type>) {
+            // elements assigned to disabled entities are disabled in turn
+            if(const auto *entities = reg.template storage<typename underlying_type::entity_type>(); entities->disabled() != 0u) {
+                for(; first != last; ++first) {
+                    entities->enabled(*first) ? void() : underlying_type::disable(*first);
+                }
+            }
+        }
+    }
+
+    void publish_construction(const typename underlying_type::entity_type entt) {
+        auto &reg = owner_or_assert();
+        disable_if_required(reg, &entt, &entt + 1u);
+        construction_range.publish(reg, &entt, &entt + 1u);
+        construction.publish(reg, entt);
+    }
+
     void pop(underlying_iterator first, underlying_iterator last) final {
-        if(auto &reg = owner_or_assert(); destruction.empty()) {
+        if(auto &reg = owner_or_assert(); !destruction_range.empty() && (last - first) == 1) {
+            // single elements don't need a copy of the range to survive listeners
+            const auto entt = *first;
+            destruction_range.publish(reg, &entt, &entt + 1u);
+            destruction.publish(reg, entt);
+            const auto it = underlying_type::find(entt);
+            underlying_type::pop(it, it + 1u);
+        } else if(!destruction_range.empty()) {
+            // listeners can shuffle the packed array, range signals work on a copy
+            const entity_container_type range(first, last, underlying_type::base_type::get_allocator());
+            destruction_range.publish(reg, range.data(), range.data() + range.size());
+
+            if(destruction.empty()) {
+                underlying_type::pop(underlying_iterator{range, static_cast<typename underlying_iterator::difference_type>(range.size())}, underlying_iterator{range, {}});
+            } else {
+                for(const auto entt: range) {
+                    destruction.publish(reg, entt);
+                    const auto it = underlying_type::find(entt);
+                    underlying_type::pop(it, it + 1u);
+                }
+            }
+        } else if(destruction.empty()) {
             underlying_type::pop(first, last);
         } else {
             for(; first != last; ++first) {
@@ -50,6 +99,19 @@ class sigh_mixin final: public Type {
     }
 
     void pop_all() final {
+        if(auto &reg = owner_or_assert(); !destruction_range.empty()) {
+            entity_container_type range(underlying_type::base_type::get_allocator());
+            range.reserve(underlying_type::size());
+
+            for(auto pos = underlying_type::each().begin().base().index(); !(pos < 0); --pos) {
+                if(const auto entt = underlying_type::operator[](static_cast<typename underlying_type::size_type>(pos)); !underlying_type::traits_type::in_place_delete || entt != tombstone) {
+                    range.push_back(entt);
+                }
+            }
+
+            destruction_range.publish(reg, range.data(), range.data() + range.size());
+        }
+
         if(auto &reg = owner_or_assert(); !destruction.empty()) {
             for(auto pos = underlying_type::each().begin().base().index(); !(pos < 0); --pos) {
                 if constexpr(underlying_type::traits_type::in_place_delete) {
@@ -68,8 +130,8 @@ class sigh_mixin final: public Type {
     underlying_iterator try_emplace(const typename underlying_type::entity_type entt, const bool force_back, const void *value) final {
         const auto it = underlying_type::try_emplace(entt, force_back, value);
 
-        if(auto &reg = owner_or_assert(); it != underlying_type::base_type::end()) {
-            construction.publish(reg, *it);
+        if(it != underlying_type::base_type::end()) {
+            publish_construction(*it);
         }
 
         return it;
@@ -96,7 +158,9 @@ public:
           owner{},
           construction{allocator},
           destruction{allocator},
-          update{allocator} {}
+          update{allocator},
+          construction_range{allocator},
+          destruction_range{allocator} {}
 
     /**
      * @brief Move constructor.
@@ -107,7 +171,9 @@ public:
           owner{other.owner},
           construction{std::move(other.construction)},
           destruction{std::move(other.destruction)},
-          update{std::move(other.update)} {}
+          update{std::move(other.update)},
+          construction_range{std::move(other.construction_range)},
+          destruction_range{std::move(other.destruction_range)} {}
 
     /**
      * @brief Allocator-extended move constructor.
@@ -119,7 +185,9 @@ public:
           owner{other.owner},
           construction{std::move(other.construction), allocator},
           destruction{std::move(other.destruction), allocator},
-          update{std::move(other.update), allocator} {}
+          update{std::move(other.update), allocator},
+          construction_range{std::move(other.construction_range), allocator},
+          destruction_range{std::move(other.destruction_range), allocator} {}
 
     /**
      * @brief Move assignment operator.
@@ -132,6 +200,8 @@ public:
         construction = std::move(other.construction);
         destruction = std::move(other.destruction);
         update = std::move(other.update);
+        construction_range = std::move(other.construction_range);
+        destruction_range = std::move(other.destruction_range);
         return *this;
     }
 
@@ -146,6 +216,8 @@ public:
         swap(construction, other.construction);
         swap(destruction, other.destruction);
         swap(update, other.update);
+        swap(construction_range, other.construction_range);
+        swap(destruction_range, other.destruction_range);
     }
 
     /**
@@ -193,6 +265,40 @@ public:
         return sink{destruction};
     }
 
+    /**
+     * @brief Returns a sink object.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever new instances are created and assigned to entities, once per
+     * batch rather than once per entity.<br/>
+     * Listeners are invoked after the objects have been assigned to the
+     * entities and before the listeners of the `on_construct` signal.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_construct_range() noexcept {
+        return sink{construction_range};
+    }
+
+    /**
+     * @brief Returns a sink object.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever instances are removed from entities and thus destroyed, once
+     * per batch rather than once per entity.<br/>
+     * Listeners are invoked before the objects have been removed from the
+     * entities and before the listeners of the `on_destroy` signal.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_destroy_range() noexcept {
+        return sink{destruction_range};
+    }
+
     /**
      * @brief Emplace elements into a storage.
      *
@@ -204,7 +310,7 @@ public:
      */
     auto emplace() {
         const auto entt = underlying_type::emplace();
-        construction.publish(owner_or_assert(), entt);
+        publish_construction(entt);
         return entt;
     }
 
@@ -224,11 +330,11 @@ public:
     decltype(auto) emplace(const entity_type hint, Args &&...args) {
         if constexpr(std::is_same_v<typename underlying_type::value_type, typename underlying_type::entity_type>) {
             const auto entt = underlying_type::emplace(hint, std::forward<Args>(args)...);
-            construction.publish(owner_or_assert(), entt);
+            publish_construction(entt);
             return entt;
         } else {
             underlying_type::emplace(hint, std::forward<Args>(args)...);
-            construction.publish(owner_or_assert(), hint);
+            publish_construction(hint);
             return this->get(hint);
         }
     }
@@ -263,6 +369,12 @@ public:
     template<typename It, typename... Args>
     void insert(It first, It last, Args &&...args) {
         underlying_type::insert(first, last, std::forward<Args>(args)...);
+        disable_if_required(owner_or_assert(), first, last);
+
+        if(auto &reg = owner_or_assert(); !construction_range.empty()) {
+            const entity_container_type range(first, last, underlying_type::base_type::get_allocator());
+            construction_range.publish(reg, range.data(), range.data() + range.size());
+        }
 
         if(auto &reg = owner_or_assert(); !construction.empty()) {
             for(; first != last; ++first) {
@@ -271,6 +383,32 @@ public:
         }
     }
 
+    /**
+     * @brief Commits the identifiers reserved so far, if any.
+     *
+     * The behavior of this operation depends on the underlying storage type
+     * (for example, components vs entities).<br/>
+     * Refer to the specific documentation for more details.
+     *
+     * @return A return value as returned by the underlying storage.
+     */
+    auto commit_reserved() {
+        const auto len = underlying_type::commit_reserved();
+
+        if(auto &reg = owner_or_assert(); len != 0u && !(construction_range.empty() && construction.empty())) {
+            // committed identifiers are the last ones before the head of the free list
+            const auto first = underlying_type::data() + (underlying_type::free_list() - len);
+            const entity_container_type range(first, first + len, underlying_type::base_type::get_allocator());
+            construction_range.publish(reg, range.data(), range.data() + range.size());
+
+            for(const auto entt: range) {
+                construction.publish(reg, entt);
+            }
+        }
+
+        return len;
+    }
+
     /**
      * @brief Forwards variables to derived classes, if any.
      * @param value A variable wrapped in an opaque container.
@@ -286,6 +424,8 @@ private:
     sigh_type construction;
     sigh_type destruction;
     sigh_type update;
+    range_sigh_type construction_range;
+    range_sigh_type destruction_range;
 };
 
 } // namespace entt
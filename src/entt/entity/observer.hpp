@@ -162,6 +162,13 @@ template<typename Registry, typename Mask, typename Allocator>
 class basic_observer: private basic_storage<Mask, typename Registry::entity_type, Allocator> {
     using base_type = basic_storage<Mask, typename Registry::entity_type, Allocator>;
 
+    template<auto Candidate>
+    static void for_each(basic_observer &obs, Registry &reg, const typename Registry::entity_type *first, const typename Registry::entity_type *last) {
+        for(; first != last; ++first) {
+            Candidate(obs, reg, *first);
+        }
+    }
+
     template<typename>
     struct matcher_handler;
 
@@ -187,17 +194,17 @@ class basic_observer: private basic_storage<Mask, typename Registry::entity_type
 
         template<std::size_t Index>
         static void connect(basic_observer &obs, Registry &reg) {
-            (reg.template on_destroy<Require>().template connect<&discard_if<Index>>(obs), ...);
-            (reg.template on_construct<Reject>().template connect<&discard_if<Index>>(obs), ...);
+            (reg.template on_destroy_range<Require>().template connect<&for_each<&discard_if<Index>>>(obs), ...);
+            (reg.template on_construct_range<Reject>().template connect<&for_each<&discard_if<Index>>>(obs), ...);
             reg.template on_update<AnyOf>().template connect<&maybe_valid_if<Index>>(obs);
-            reg.template on_destroy<AnyOf>().template connect<&discard_if<Index>>(obs);
+            reg.template on_destroy_range<AnyOf>().template connect<&for_each<&discard_if<Index>>>(obs);
         }
 
         static void disconnect(basic_observer &obs, Registry &reg) {
-            (reg.template on_destroy<Require>().disconnect(&obs), ...);
-            (reg.template on_construct<Reject>().disconnect(&obs), ...);
+            (reg.template on_destroy_range<Require>().disconnect(&obs), ...);
+            (reg.template on_construct_range<Reject>().disconnect(&obs), ...);
             reg.template on_update<AnyOf>().disconnect(&obs);
-            reg.template on_destroy<AnyOf>().disconnect(&obs);
+            reg.template on_destroy_range<AnyOf>().disconnect(&obs);
         }
     };
 
@@ -231,21 +238,21 @@ class basic_observer: private basic_storage<Mask, typename Registry::entity_type
 
         template<std::size_t Index>
         static void connect(basic_observer &obs, Registry &reg) {
-            (reg.template on_destroy<Require>().template connect<&discard_if<Index>>(obs), ...);
-            (reg.template on_construct<Reject>().template connect<&discard_if<Index>>(obs), ...);
-            (reg.template on_construct<AllOf>().template connect<&maybe_valid_if<Index>>(obs), ...);
-            (reg.template on_destroy<NoneOf>().template connect<&maybe_valid_if<Index, NoneOf>>(obs), ...);
-            (reg.template on_destroy<AllOf>().template connect<&discard_if<Index>>(obs), ...);
-            (reg.template on_construct<NoneOf>().template connect<&discard_if<Index>>(obs), ...);
+            (reg.template on_destroy_range<Require>().template connect<&for_each<&discard_if<Index>>>(obs), ...);
+            (reg.template on_construct_range<Reject>().template connect<&for_each<&discard_if<Index>>>(obs), ...);
+            (reg.template on_construct_range<AllOf>().template connect<&for_each<&maybe_valid_if<Index>>>(obs), ...);
+            (reg.template on_destroy_range<NoneOf>().template connect<&for_each<&maybe_valid_if<Index, NoneOf>>>(obs), ...);
+            (reg.template on_destroy_range<AllOf>().template connect<&for_each<&discard_if<Index>>>(obs), ...);
+            (reg.template on_construct_range<NoneOf>().template connect<&for_each<&discard_if<Index>>>(obs), ...);
         }
 
         static void disconnect(basic_observer &obs, Registry &reg) {
-            (reg.template on_destroy<Require>().disconnect(&obs), ...);
-            (reg.template on_construct<Reject>().disconnect(&obs), ...);
-            (reg.template on_construct<AllOf>().disconnect(&obs), ...);
-            (reg.template on_destroy<NoneOf>().disconnect(&obs), ...);
-            (reg.template on_destroy<AllOf>().disconnect(&obs), ...);
-            (reg.template on_construct<NoneOf>().disconnect(&obs), ...);
+            (reg.template on_destroy_range<Require>().disconnect(&obs), ...);
+            (reg.template on_construct_range<Reject>().disconnect(&obs), ...);
+            (reg.template on_construct_range<AllOf>().disconnect(&obs), ...);
+            (reg.template on_destroy_range<NoneOf>().disconnect(&obs), ...);
+            (reg.template on_destroy_range<AllOf>().disconnect(&obs), ...);
+            (reg.template on_construct_range<NoneOf>().disconnect(&obs), ...);
         }
     };
 
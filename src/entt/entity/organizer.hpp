@@ -8,8 +8,9 @@
 #include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
 #include "../core/utility.hpp"
-#include "../graph/adjacency_matrix.hpp"
+#include "../graph/compressed_graph.hpp"
 #include "../graph/flow.hpp"
+#include "../graph/schedule.hpp"
 #include "fwd.hpp"
 #include "helper.hpp"
 
@@ -170,6 +171,8 @@ public:
     using size_type = std::size_t;
     /*! @brief Raw task function type. */
     using function_type = callback_type;
+    /*! @brief Cost type. */
+    using cost_type = double;
 
     /*! @brief Vertex type of a task graph defined as an adjacency list. */
     struct vertex {
@@ -182,9 +185,13 @@ public:
          */
         vertex(vertex_data data, std::vector<std::size_t> edges, std::vector<std::size_t> predecessors)
             : is_top_level{predecessors.empty()},
+              is_critical{},
               node{std::move(data)},
               successors_vec{std::move(edges)},
-              predecessors_vec{std::move(predecessors)} {}
+              predecessors_vec{std::move(predecessors)},
+              weight{1.0},
+              start{},
+              rank{} {}
 
         /**
          * @brief Fills a buffer with the type info objects for the writable
@@ -288,6 +295,51 @@ public:
             return successors_vec;
         }
 
+        /**
+         * @brief Returns the cost associated with a vertex.
+         * @return The cost associated with the vertex.
+         */
+        cost_type cost() const noexcept {
+            return weight;
+        }
+
+        /**
+         * @brief Assigns a cost to a vertex.
+         *
+         * Costs are arbitrary non-negative values, for example the declared or
+         * measured durations of the tasks. The default cost is one.
+         *
+         * @param value The cost to associate with the vertex.
+         */
+        void cost(const cost_type value) noexcept {
+            weight = value;
+        }
+
+        /**
+         * @brief Returns the earliest start of a vertex.
+         * @return The sum of the costs along the longest path to the vertex.
+         */
+        cost_type earliest_start() const noexcept {
+            return start;
+        }
+
+        /**
+         * @brief Returns the priority of a vertex.
+         * @return The sum of the costs along the longest path from the vertex to
+         * the end of the graph, the vertex itself included.
+         */
+        cost_type priority() const noexcept {
+            return rank;
+        }
+
+        /**
+         * @brief Checks if a vertex is on the critical path of the graph.
+         * @return True if the vertex is on the critical path, false otherwise.
+         */
+        bool critical() const noexcept {
+            return is_critical;
+        }
+
         /**
          * @brief Prepares a registry and assures that all required resources
          * are properly instantiated before using them.
@@ -298,10 +350,16 @@ public:
         }
 
     private:
+        friend class basic_organizer;
+
         bool is_top_level;
+        bool is_critical;
         vertex_data node;
         std::vector<std::size_t> successors_vec;
         std::vector<std::size_t> predecessors_vec;
+        cost_type weight;
+        cost_type start;
+        cost_type rank;
     };
 
     /**
@@ -399,27 +457,56 @@ public:
     std::vector<vertex> graph() {
         std::vector<vertex> adjacency_list{};
         adjacency_list.reserve(vertices.size());
-        auto adjacency_matrix = builder.graph();
+        auto task_graph = builder.graph();
 
-        for(auto curr: adjacency_matrix.vertices()) {
-            const auto iterable = adjacency_matrix.in_edges(curr);
+        for(auto curr: task_graph.vertices()) {
             std::vector<std::size_t> successors{};
             std::vector<std::size_t> predecessors{};
 
-            for(auto &&edge: adjacency_matrix.in_edges(curr)) {
+            for(auto &&edge: task_graph.in_edges(curr)) {
                 predecessors.push_back(edge.first);
             }
 
-            for(auto &&edge: adjacency_matrix.out_edges(curr)) {
+            for(auto &&edge: task_graph.out_edges(curr)) {
                 successors.push_back(edge.second);
             }
 
             adjacency_list.emplace_back(vertices[curr], std::move(successors), std::move(predecessors));
         }
 
+        prioritize(adjacency_list);
         return adjacency_list;
     }
 
+    /**
+     * @brief Updates earliest start, priority and critical path of a task
+     * graph from the costs of its vertices.
+     * @param graph A task graph, as returned by an organizer.
+     */
+    static void prioritize(std::vector<vertex> &graph) {
+        std::vector<std::pair<std::size_t, std::size_t>> edges{};
+
+        for(std::size_t pos{}, last = graph.size(); pos < last; ++pos) {
+            graph[pos].is_critical = false;
+
+            for(auto child: graph[pos].children()) {
+                edges.emplace_back(pos, child);
+            }
+        }
+
+        const compressed_graph<> task_graph{graph.size(), edges.cbegin(), edges.cend()};
+        const basic_schedule<> plan{task_graph, [&graph](const std::size_t pos) { return graph[pos].cost(); }};
+
+        for(std::size_t pos{}, last = graph.size(); pos < last; ++pos) {
+            graph[pos].start = plan.earliest_start(pos);
+            graph[pos].rank = plan.priority(pos);
+        }
+
+        for(auto pos: plan.critical_path()) {
+            graph[pos].is_critical = true;
+        }
+    }
+
     /*! @brief Erases all elements from a container. */
     void clear() {
         builder.clear();
@@ -0,0 +1,263 @@
+#ifndef ENTT_ENTITY_OWNING_VIEW_HPP
+#define ENTT_ENTITY_OWNING_VIEW_HPP
+
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "../core/algorithm.hpp"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "../core/type_traits.hpp"
+#include "fwd.hpp"
+#include "group.hpp"
+#include "view.hpp"
+
+namespace entt {
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+template<typename, typename>
+class lazy_group_handler;
+
+template<typename... Owned, typename... Exclude>
+class lazy_group_handler<owned_t<Owned...>, exclude_t<Exclude...>> final: public group_descriptor<typename std::common_type_t<typename Owned::base_type..., typename Exclude::base_type...>::entity_type> {
+    static_assert(!std::disjunction_v<std::is_const<Owned>..., std::is_const<Exclude>...>, "Const storage type not allowed");
+
+public:
+    using handler_type = group_handler<owned_t<Owned...>, get_t<>, exclude_t<Exclude...>>;
+    using size_type = typename handler_type::size_type;
+
+    lazy_group_handler(Owned &...opool, Exclude &...epool)
+        : pools{&opool...},
+          filter{&epool...},
+          handler{},
+          released{} {}
+
+    size_type owned(const id_type *elem, const size_type length) const noexcept final {
+        size_type cnt = 0u;
+
+        for(auto pos = 0u; !released && pos < length; ++pos) {
+            cnt += ((elem[pos] == entt::type_hash<typename Owned::value_type>::value()) || ...);
+        }
+
+        return cnt;
+    }
+
+    void release() noexcept final {
+        // groups returned so far may still refer to the handler, keep it alive
+        if(handler) {
+            handler->disconnect();
+        }
+
+        released = true;
+    }
+
+    [[nodiscard]] handler_type *claim() {
+        if(!released && !handler) {
+            std::apply([this](auto *...cpool) { handler.emplace(*cpool...); }, std::tuple_cat(pools, filter));
+        }
+
+        return released ? nullptr : &*handler;
+    }
+
+    [[nodiscard]] bool claimed() const noexcept {
+        return !released && handler.has_value();
+    }
+
+    template<typename Type>
+    Type pools_as() const noexcept {
+        return pools;
+    }
+
+    template<typename Type>
+    Type filter_as() const noexcept {
+        return filter;
+    }
+
+private:
+    std::tuple<Owned *...> pools;
+    std::tuple<Exclude *...> filter;
+    std::optional<handler_type> handler;
+    bool released;
+};
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Lazy owning view.
+ *
+ * Primary template isn't defined on purpose. All the specializations give a
+ * compile-time error, but for a few reasonable cases.
+ */
+template<typename, typename>
+class basic_owning_view;
+
+/**
+ * @brief Lazy owning view.
+ *
+ * A lazy owning view iterates the same entities as a view on the same storage
+ * but it claims ownership of its pools the first time it's iterated. From then
+ * on, it works like a full-owning group: the entities of interest are kept in
+ * a packed prefix of the pools and iterations don't look up anything.<br/>
+ * Ownership is given up in favor of any group that conflicts with the view and
+ * isn't claimed at all if such a group already exists. In both cases, lazy
+ * owning views fall back to the iteration scheme of regular views. Groups
+ * already returned by the view remain valid but are empty from then on.
+ *
+ * @warning
+ * Claiming ownership rearranges the pools. Therefore, the first iteration
+ * mustn't run concurrently with any other iteration on the same pools.
+ *
+ * @tparam Owned Types of storage _owned_ by the view.
+ * @tparam Exclude Types of storage used to filter the view.
+ */
+template<typename... Owned, typename... Exclude>
+class basic_owning_view<owned_t<Owned...>, exclude_t<Exclude...>> {
+    auto pools() const noexcept {
+        using return_type = std::tuple<Owned *...>;
+        return descriptor ? descriptor->template pools_as<return_type>() : return_type{};
+    }
+
+    auto filter() const noexcept {
+        using return_type = std::tuple<Exclude *...>;
+        return descriptor ? descriptor->template filter_as<return_type>() : return_type{};
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief View type used when the pools aren't owned. */
+    using view_type = basic_view<get_t<Owned...>, exclude_t<Exclude...>>;
+    /*! @brief Group type used once the pools are owned. */
+    using group_type = basic_group<owned_t<Owned...>, get_t<>, exclude_t<Exclude...>>;
+    /*! @brief Lazy group handler type. */
+    using handler = internal::lazy_group_handler<owned_t<std::remove_const_t<Owned>...>, exclude_t<std::remove_const_t<Exclude>...>>;
+
+    /*! @brief Default constructor to use to create empty, invalid views. */
+    basic_owning_view() noexcept
+        : descriptor{} {}
+
+    /**
+     * @brief Constructs a lazy owning view from a lazy group handler.
+     * @param ref A reference to a lazy group handler.
+     */
+    basic_owning_view(handler &ref) noexcept
+        : descriptor{&ref} {}
+
+    /**
+     * @brief Returns a view on the storage of a lazy owning view.
+     * @return A view on the storage of the lazy owning view.
+     */
+    [[nodiscard]] view_type view() const noexcept {
+        return descriptor ? std::apply([](auto *...curr) { return view_type{*curr...}; }, std::tuple_cat(pools(), filter())) : view_type{};
+    }
+
+    /**
+     * @brief Claims ownership of the pools, if possible, and returns the
+     * resulting group.
+     * @return A valid group if the view owns its pools, an invalid one
+     * otherwise.
+     */
+    [[nodiscard]] group_type group() const {
+        auto *elem = descriptor ? descriptor->claim() : nullptr;
+        return elem ? group_type{*elem} : group_type{};
+    }
+
+    /**
+     * @brief Checks whether a lazy owning view owns its pools.
+     * @return True if the view owns its pools, false otherwise.
+     */
+    [[nodiscard]] bool owned() const noexcept {
+        return descriptor && descriptor->claimed();
+    }
+
+    /**
+     * @brief Estimates the number of entities iterated by the view.
+     * @return Estimated number of entities iterated by the view.
+     */
+    [[nodiscard]] size_type size_hint() const noexcept {
+        return owned() ? descriptor->claim()->length() : view().size_hint();
+    }
+
+    /**
+     * @brief Checks if a lazy owning view is properly initialized.
+     * @return True if the view is properly initialized, false otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return descriptor != nullptr;
+    }
+
+    /**
+     * @brief Checks if a lazy owning view contains an entity.
+     * @param entt A valid identifier.
+     * @return True if the view contains the given entity, false otherwise.
+     */
+    [[nodiscard]] bool contains(const typename view_type::entity_type entt) const noexcept {
+        return view().contains(entt);
+    }
+
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them.
+     *
+     * Ownership of the pools is claimed on the first invocation, if possible.
+     *
+     * @sa basic_view::each
+     * @sa basic_group::each
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        if(const auto elem = group(); elem) {
+            elem.each(std::move(func));
+        } else {
+            view().each(std::move(func));
+        }
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * Ownership of the pools is claimed before dispatching any work, if
+     * possible.
+     *
+     * @sa basic_view::each
+     * @sa basic_group::each
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param exec A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    std::enable_if_t<is_executor_v<Executor>> each(Executor &&exec, Func func) const {
+        if(const auto elem = group(); elem) {
+            elem.each(std::forward<Executor>(exec), std::move(func));
+        } else {
+            view().each(std::forward<Executor>(exec), std::move(func));
+        }
+    }
+
+private:
+    handler *descriptor;
+};
+
+} // namespace entt
+
+#endif
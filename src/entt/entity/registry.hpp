@@ -24,6 +24,7 @@
 #include "fwd.hpp"
 #include "group.hpp"
 #include "mixin.hpp"
+#include "owning_view.hpp"
 #include "sparse_set.hpp"
 #include "storage.hpp"
 #include "view.hpp"
@@ -245,7 +246,7 @@ class basic_registry {
 
     // std::shared_ptr because of its type erased allocator which is useful here
     using pool_container_type = dense_map<id_type, std::shared_ptr<base_type>, identity, std::equal_to<id_type>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, std::shared_ptr<base_type>>>>;
-    using group_container_type = dense_map<id_type, std::shared_ptr<internal::group_descriptor>, identity, std::equal_to<id_type>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, std::shared_ptr<internal::group_descriptor>>>>;
+    using group_container_type = dense_map<id_type, std::shared_ptr<internal::group_descriptor<Entity>>, identity, std::equal_to<id_type>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, std::shared_ptr<internal::group_descriptor<Entity>>>>>;
 
     template<typename Type>
     [[nodiscard]] auto &assure([[maybe_unused]] const id_type id = type_hash<Type>::value()) {
@@ -727,9 +728,9 @@ public:
                 count += cpools[pos]->remove(first, last);
             }
         } else {
-            for(auto cpools = std::forward_as_tuple(assure<Type>(), assure<Other>()...); first != last; ++first) {
-                count += std::apply([entt = *first](auto &...curr) { return (curr.remove(entt) + ... + 0u); }, cpools);
-            }
+            // entities are collected first, so that each pool is walked once and emptied in bulk
+            const std::vector<entity_type, allocator_type> doomed(first, last, get_allocator());
+            count = (assure<Type>().remove(doomed.begin(), doomed.end()) + ... + assure<Other>().remove(doomed.begin(), doomed.end()));
         }
 
         return count;
@@ -777,9 +778,8 @@ public:
                 cpools[pos]->erase(first, last);
             }
         } else {
-            for(auto cpools = std::forward_as_tuple(assure<Type>(), assure<Other>()...); first != last; ++first) {
-                std::apply([entt = *first](auto &...curr) { (curr.erase(entt), ...); }, cpools);
-            }
+            const std::vector<entity_type, allocator_type> doomed(first, last, get_allocator());
+            (assure<Type>().erase(doomed.begin(), doomed.end()), (assure<Other>().erase(doomed.begin(), doomed.end()), ...));
         }
     }
 
@@ -823,6 +823,95 @@ public:
         }
     }
 
+    /**
+     * @brief Removes tombstones from a registry or only the pools for the
+     * given components, a few at a time.
+     *
+     * The budget is shared by all the pools involved, that are processed in
+     * order. Subsequent calls resume where the previous one stopped.
+     *
+     * @sa basic_sparse_set::compact
+     *
+     * @tparam Type Types of components for which to clear tombstones.
+     * @param budget Maximum number of tombstones to process.
+     * @return The number of tombstones actually processed.
+     */
+    template<typename... Type>
+    size_type compact(const size_type budget) {
+        size_type count{};
+
+        if constexpr(sizeof...(Type) == 0u) {
+            for(auto &&curr: pools) {
+                count += curr.second->compact(budget - count);
+            }
+        } else {
+            ((count += assure<Type>().compact(budget - count)), ...);
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Disables an entity without removing its components.
+     *
+     * The entity and its components are moved to the disabled part of their
+     * storage, where views don't look for them. Storage with in-place deletion
+     * policy mark them as disabled instead, so as not to move them around.<br/>
+     * Components assigned to a disabled entity are disabled in turn and
+     * non-owning groups drop the entity until it's enabled again.
+     *
+     * @warning
+     * Disabling an entity that has components in a storage owned by a group
+     * results in undefined behavior, whether the entity belongs to the group
+     * or not. Owning groups and disabled entities both arrange elements at the
+     * beginning of the packed arrays and therefore cannot share a storage.
+     *
+     * @param entt A valid identifier.
+     */
+    void disable(const entity_type entt) {
+        ENTT_ASSERT(valid(entt), "Invalid identifier");
+        entities.disable(entt);
+
+        for(auto &&curr: pools) {
+            if(curr.second->contains(entt)) {
+                ENTT_ASSERT(std::none_of(groups.cbegin(), groups.cend(), [&curr](const auto &data) { return data.second->owned(&curr.first, 1u) != 0u; }), "Owned storage");
+                curr.second->disable(entt);
+            }
+        }
+
+        for(auto &&curr: groups) {
+            curr.second->disable(entt);
+        }
+    }
+
+    /**
+     * @brief Enables an entity previously disabled.
+     * @param entt A valid identifier.
+     */
+    void enable(const entity_type entt) {
+        ENTT_ASSERT(valid(entt), "Invalid identifier");
+        entities.enable(entt);
+
+        for(auto &&curr: pools) {
+            if(curr.second->contains(entt)) {
+                curr.second->enable(entt);
+            }
+        }
+
+        for(auto &&curr: groups) {
+            curr.second->enable(entt);
+        }
+    }
+
+    /**
+     * @brief Checks if an entity is enabled.
+     * @param entt A valid identifier.
+     * @return True if the entity is enabled, false otherwise.
+     */
+    [[nodiscard]] bool enabled(const entity_type entt) const {
+        return entities.enabled(entt);
+    }
+
     /**
      * @brief Check if an entity is part of all the given storage.
      * @tparam Type Type of storage to check for.
@@ -1035,6 +1124,58 @@ public:
         return assure<Type>(id).on_destroy();
     }
 
+    /**
+     * @brief Returns a sink object for the given component.
+     *
+     * Use this function to receive notifications whenever instances of the
+     * given component are created and assigned to entities, once per batch.
+     * <br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<Entity> &, const Entity *, const Entity *);
+     * @endcode
+     *
+     * Listeners are invoked **after** assigning the components to the entities
+     * and **before** the listeners of the `on_construct` signal.
+     *
+     * @sa sink
+     *
+     * @tparam Type Type of component of which to get the sink.
+     * @param id Optional name used to map the storage within the registry.
+     * @return A temporary sink object.
+     */
+    template<typename Type>
+    [[nodiscard]] auto on_construct_range(const id_type id = type_hash<Type>::value()) {
+        return assure<Type>(id).on_construct_range();
+    }
+
+    /**
+     * @brief Returns a sink object for the given component.
+     *
+     * Use this function to receive notifications whenever instances of the
+     * given component are removed from entities and thus destroyed, once per
+     * batch.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<Entity> &, const Entity *, const Entity *);
+     * @endcode
+     *
+     * Listeners are invoked **before** removing the components from the
+     * entities and **before** the listeners of the `on_destroy` signal.
+     *
+     * @sa sink
+     *
+     * @tparam Type Type of component of which to get the sink.
+     * @param id Optional name used to map the storage within the registry.
+     * @return A temporary sink object.
+     */
+    template<typename Type>
+    [[nodiscard]] auto on_destroy_range(const id_type id = type_hash<Type>::value()) {
+        return assure<Type>(id).on_destroy_range();
+    }
+
     /**
      * @brief Returns a view for the given components.
      * @tparam Type Type of component used to construct the view.
@@ -1079,9 +1220,69 @@ public:
         if constexpr(sizeof...(Owned) == 0u) {
             handler = std::allocate_shared<handler_type>(get_allocator(), get_allocator(), assure<std::remove_const_t<Get>>()..., assure<std::remove_const_t<Exclude>>()...);
         } else {
+            const id_type elem[]{type_hash<std::remove_const_t<Owned>>::value()..., type_hash<std::remove_const_t<Get>>::value()..., type_hash<std::remove_const_t<Exclude>>::value()...};
+
+            internal::group_descriptor<Entity> *parent{};
+            internal::group_descriptor<Entity> *child{};
+
+            for(auto &&data: groups) {
+                auto *curr = data.second.get();
+
+                if(curr->owned(elem, sizeof...(Owned)) != 0u) {
+                    // lazy owning views give up their pools in favor of groups
+                    curr->release();
+                }
+
+                // groups that share pools must be nested, the wider ones come first
+                if(curr->owned(elem, sizeof...(Owned)) != 0u) {
+                    if(curr->wider(elem, sizeof...(Owned), sizeof...(Get), sizeof...(Exclude))) {
+                        parent = (curr->child && curr->child->wider(elem, sizeof...(Owned), sizeof...(Get), sizeof...(Exclude))) ? parent : curr;
+                    } else {
+                        ENTT_ASSERT(curr->narrower(elem, sizeof...(Owned), sizeof...(Get), sizeof...(Exclude)), "Conflicting groups");
+                        child = (curr->parent && !curr->parent->wider(elem, sizeof...(Owned), sizeof...(Get), sizeof...(Exclude))) ? child : curr;
+                    }
+                }
+            }
+
+            ENTT_ASSERT((!parent || parent->child == child) && (!child || child->parent == parent), "Conflicting groups");
             handler = std::allocate_shared<handler_type>(get_allocator(), assure<std::remove_const_t<Owned>>()..., assure<std::remove_const_t<Get>>()..., assure<std::remove_const_t<Exclude>>()...);
-            [[maybe_unused]] const id_type elem[]{type_hash<std::remove_const_t<Owned>>::value()..., type_hash<std::remove_const_t<Get>>::value()..., type_hash<std::remove_const_t<Exclude>>::value()...};
-            ENTT_ASSERT(std::all_of(groups.cbegin(), groups.cend(), [&elem](const auto &data) { return data.second->owned(elem, sizeof...(Owned)) == 0u; }), "Conflicting groups");
+            handler->parent = parent;
+            handler->child = child;
+            parent ? void(parent->child = handler.get()) : void();
+            child ? void(child->parent = handler.get()) : void();
+        }
+
+        groups.emplace(type_hash<handler_type>::value(), handler);
+        return {*handler};
+    }
+
+    /**
+     * @brief Returns a lazy owning view for the given components.
+     *
+     * Lazy owning views don't claim their pools until they are iterated for
+     * the first time. They give them up as soon as a conflicting group is
+     * created. If such a group already exists, the view behaves like a regular
+     * view from the beginning.
+     *
+     * @tparam Type Type of component used to construct the view.
+     * @tparam Other Other types of components used to construct the view.
+     * @tparam Exclude Types of components used to filter the view.
+     * @return A newly created lazy owning view.
+     */
+    template<typename Type, typename... Other, typename... Exclude>
+    basic_owning_view<owned_t<storage_for_type<Type>, storage_for_type<Other>...>, exclude_t<storage_for_type<Exclude>...>>
+    owning_view(exclude_t<Exclude...> = exclude_t{}) {
+        using handler_type = typename basic_owning_view<owned_t<storage_for_type<Type>, storage_for_type<Other>...>, exclude_t<storage_for_type<Exclude>...>>::handler;
+
+        if(auto it = groups.find(type_hash<handler_type>::value()); it != groups.cend()) {
+            return {*std::static_pointer_cast<handler_type>(it->second)};
+        }
+
+        auto handler = std::allocate_shared<handler_type>(get_allocator(), assure<std::remove_const_t<Type>>(), assure<std::remove_const_t<Other>>()..., assure<std::remove_const_t<Exclude>>()...);
+        const id_type elem[]{type_hash<std::remove_const_t<Type>>::value(), type_hash<std::remove_const_t<Other>>::value()...};
+
+        if(std::any_of(groups.cbegin(), groups.cend(), [&elem](const auto &data) { return data.second->owned(elem, 1u + sizeof...(Other)) != 0u; })) {
+            handler->release();
         }
 
         groups.emplace(type_hash<handler_type>::value(), handler);
@@ -1148,7 +1349,7 @@ public:
      * @param args Arguments to forward to the sort function object, if any.
      */
     template<typename Type, typename Compare, typename Sort = std_sort, typename... Args>
-    void sort(Compare compare, Sort algo = Sort{}, Args &&...args) {
+    std::enable_if_t<!is_executor_v<Compare>> sort(Compare compare, Sort algo = Sort{}, Args &&...args) {
         ENTT_ASSERT(!owned<Type>(), "Cannot sort owned storage");
         auto &cpool = assure<Type>();
 
@@ -1160,6 +1361,38 @@ public:
         }
     }
 
+    /**
+     * @brief Sorts the elements of a given component in parallel.
+     *
+     * @sa sort
+     * @sa basic_sparse_set::sort_n
+     *
+     * @warning
+     * Pools of components owned by a group cannot be sorted.
+     *
+     * @tparam Type Type of components to sort.
+     * @tparam Executor Type of executor.
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param exec A valid executor.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Type, typename Executor, typename Compare, typename Sort = parallel_sort, typename... Args>
+    std::enable_if_t<is_executor_v<Executor>> sort(Executor &&exec, Compare compare, Sort algo = Sort{}, Args &&...args) {
+        ENTT_ASSERT(!owned<Type>(), "Cannot sort owned storage");
+        auto &cpool = assure<Type>();
+
+        if constexpr(std::is_invocable_v<Compare, decltype(cpool.get({})), decltype(cpool.get({}))>) {
+            auto comp = [&cpool, compare = std::move(compare)](const auto lhs, const auto rhs) { return compare(std::as_const(cpool.get(lhs)), std::as_const(cpool.get(rhs))); };
+            cpool.sort(exec, std::move(comp), std::move(algo), std::forward<Args>(args)...);
+        } else {
+            cpool.sort(exec, std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        }
+    }
+
     /**
      * @brief Sorts two pools of components in the same way.
      *
@@ -1179,6 +1412,25 @@ public:
         assure<To>().sort_as(assure<From>());
     }
 
+    /**
+     * @brief Sorts two pools of components in the same way, in parallel.
+     *
+     * @sa sort
+     *
+     * @warning
+     * Pools of components owned by a group cannot be sorted.
+     *
+     * @tparam To Type of components to sort.
+     * @tparam From Type of components to use to sort.
+     * @tparam Executor Type of executor.
+     * @param exec A valid executor.
+     */
+    template<typename To, typename From, typename Executor>
+    std::enable_if_t<is_executor_v<Executor>> sort(Executor &&exec) {
+        ENTT_ASSERT(!owned<To>(), "Cannot sort owned storage");
+        assure<To>().sort_as(exec, assure<From>());
+    }
+
     /**
      * @brief Returns the context object, that is, a general purpose container.
      * @return The context object, that is, a general purpose container.
@@ -2,12 +2,17 @@
 #define ENTT_ENTITY_RUNTIME_VIEW_HPP
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <iterator>
+#include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
+#include "../config/config.h"
 #include "entity.hpp"
 #include "fwd.hpp"
+#include "sparse_set.hpp"
 
 namespace entt {
 
@@ -24,10 +29,15 @@ class runtime_view_iterator final {
 
     [[nodiscard]] bool valid() const {
         return (!tombstone_check || *it != tombstone)
-               && std::all_of(++pools->begin(), pools->end(), [entt = *it](const auto *curr) { return curr->contains(entt); })
+               && (muted_check ? std::all_of(pools->begin(), pools->end(), [entt = *it](const auto *curr) { return curr->enabled(entt); }) : std::all_of(++pools->begin(), pools->end(), [entt = *it](const auto *curr) { return curr->contains(entt); }))
                && std::none_of(filter->cbegin(), filter->cend(), [entt = *it](const auto *curr) { return curr && curr->contains(entt); });
     }
 
+    [[nodiscard]] iterator_type last() const {
+        // disabled entities are at the end of the iteration order
+        return (*pools)[0]->end() - static_cast<typename iterator_type::difference_type>((*pools)[0]->disabled_prefix());
+    }
+
 public:
     using difference_type = typename iterator_type::difference_type;
     using value_type = typename iterator_type::value_type;
@@ -39,20 +49,22 @@ public:
         : pools{},
           filter{},
           it{},
-          tombstone_check{} {}
+          tombstone_check{},
+          muted_check{} {}
 
     runtime_view_iterator(const std::vector<Set *> &cpools, const std::vector<Set *> &ignore, iterator_type curr) noexcept
         : pools{&cpools},
           filter{&ignore},
           it{curr},
-          tombstone_check{pools->size() == 1u && (*pools)[0u]->policy() == deletion_policy::in_place} {
-        if(it != (*pools)[0]->end() && !valid()) {
+          tombstone_check{pools->size() == 1u && (*pools)[0u]->policy() == deletion_policy::in_place},
+          muted_check{std::any_of(pools->begin(), pools->end(), [](const auto *elem) { return elem->disabled() != 0u; })} {
+        if(it != last() && !valid()) {
             ++(*this);
         }
     }
 
     runtime_view_iterator &operator++() {
-        while(++it != (*pools)[0]->end() && !valid()) {}
+        while(++it != last() && !valid()) {}
         return *this;
     }
 
@@ -92,6 +104,86 @@ private:
     const std::vector<Set *> *filter;
     iterator_type it;
     bool tombstone_check;
+    bool muted_check;
+};
+
+template<typename Container>
+class runtime_view_block final {
+    using set_type = std::remove_pointer_t<typename Container::value_type>;
+    using alloc_traits = std::allocator_traits<typename Container::allocator_type>;
+    using entity_type = typename set_type::entity_type;
+
+    [[nodiscard]] std::size_t column(const set_type &base) const noexcept {
+        const auto pos = static_cast<std::size_t>(std::find(pools->cbegin(), pools->cend(), &base) - pools->cbegin());
+        ENTT_ASSERT(pos < pools->size(), "Storage not iterated by the view");
+        return pos * block_size;
+    }
+
+public:
+    using size_type = std::size_t;
+    using pointer = decltype(std::declval<set_type &>().value(std::declval<entity_type>()));
+    static constexpr size_type block_size = 64u;
+
+    runtime_view_block(const Container &cpools)
+        : pools{&cpools},
+          entities{},
+          indexes(cpools.size() * block_size, cpools.get_allocator()),
+          values(cpools.size() * block_size, cpools.get_allocator()),
+          cached(cpools.size(), cpools.get_allocator()),
+          len{} {}
+
+    [[nodiscard]] bool push(const entity_type entt) noexcept {
+        entities[len] = entt;
+        return (++len == block_size);
+    }
+
+    void prepare() {
+        for(size_type pos{}, last = pools->size(); pos < last; ++pos) {
+            for(size_type elem{}; elem < len; ++elem) {
+                indexes[pos * block_size + elem] = (*pools)[pos]->index(entities[elem]);
+            }
+
+            cached[pos] = false;
+        }
+    }
+
+    void clear() noexcept {
+        len = 0u;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return len;
+    }
+
+    [[nodiscard]] const entity_type *data() const noexcept {
+        return entities.data();
+    }
+
+    [[nodiscard]] const size_type *index(const set_type &base) const noexcept {
+        return indexes.data() + column(base);
+    }
+
+    [[nodiscard]] const pointer *value(set_type &base) {
+        const auto offset = column(base);
+
+        if(auto &&flag = cached[offset / block_size]; !flag) {
+            for(size_type elem{}; elem < len; ++elem) {
+                values[offset + elem] = base.value(entities[elem]);
+            }
+
+            flag = true;
+        }
+
+        return values.data() + offset;
+    }
+
+private:
+    const Container *pools;
+    std::array<entity_type, block_size> entities;
+    std::vector<size_type, typename alloc_traits::template rebind_alloc<size_type>> indexes;
+    std::vector<pointer, typename alloc_traits::template rebind_alloc<pointer>> values;
+    std::vector<bool, typename alloc_traits::template rebind_alloc<bool>> cached;
+    size_type len;
 };
 
 } // namespace internal
@@ -141,6 +233,8 @@ public:
     using common_type = Type;
     /*! @brief Bidirectional iterator type. */
     using iterator = internal::runtime_view_iterator<common_type>;
+    /*! @brief Type of blocks of entities returned during block-wise iterations. */
+    using block_type = internal::runtime_view_block<container_type>;
 
     /*! @brief Default constructor to use to create empty, invalid views. */
     basic_runtime_view() noexcept
@@ -266,7 +360,7 @@ public:
      * given components.
      */
     [[nodiscard]] iterator end() const {
-        return pools.empty() ? iterator{} : iterator{pools, filter, pools[0]->end()};
+        return pools.empty() ? iterator{} : iterator{pools, filter, pools[0]->end() - static_cast<typename common_type::iterator::difference_type>(pools[0]->disabled_prefix())};
     }
 
     /**
@@ -276,7 +370,7 @@ public:
      */
     [[nodiscard]] bool contains(const entity_type entt) const {
         return !pools.empty()
-               && std::all_of(pools.cbegin(), pools.cend(), [entt](const auto *curr) { return curr->contains(entt); })
+               && std::all_of(pools.cbegin(), pools.cend(), [entt](const auto *curr) { return curr->enabled(entt); })
                && std::none_of(filter.cbegin(), filter.cend(), [entt](const auto *curr) { return curr && curr->contains(entt); });
     }
 
@@ -296,8 +390,66 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
-        for(const auto entity: *this) {
-            func(entity);
+        if(pools.size() > 1u && std::all_of(++pools.cbegin(), pools.cend(), [](const auto *curr) { return curr->presence_index(); }) && internal::presence_pays_off(++pools.cbegin(), pools.cend(), pools[0u]->size())) {
+            // intersects presence indexes a word at a time when all pools offer one and there are enough candidates
+            const auto bitset = internal::presence_intersection(++pools.cbegin(), pools.cend());
+
+            for(auto first = pools[0u]->begin(), last = pools[0u]->end() - static_cast<typename common_type::iterator::difference_type>(pools[0u]->disabled_prefix()); first != last; ++first) {
+                if(const auto entity = *first; internal::presence_test(bitset, entity) && contains(entity)) {
+                    func(entity);
+                }
+            }
+        } else {
+            for(const auto entity: *this) {
+                func(entity);
+            }
+        }
+    }
+
+    /**
+     * @brief Iterates entities in blocks and applies the given function object
+     * to them.
+     *
+     * Matching entities are gathered in blocks of at most
+     * `block_type::block_size` elements and the function object is invoked
+     * once per block. The following member functions of a block are available:
+     *
+     * * `size`, the number of entities in the block.
+     * * `data`, a pointer to the entities of the block.
+     * * `index`, a pointer to the positions of the entities of the block in
+     *   the packed array of the given storage.
+     * * `value`, a pointer to opaque pointers to the elements assigned to the
+     *   entities of the block by the given storage, if any.
+     *
+     * Indexes are computed upfront for all storage, while opaque pointers are
+     * only looked up on request. In both cases, the given storage must be one
+     * of those iterated by the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(block_type &);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_block(Func func) const {
+        if(!pools.empty()) {
+            block_type block{pools};
+
+            each([&block, &func](const auto entity) {
+                if(block.push(entity)) {
+                    block.prepare();
+                    func(block);
+                    block.clear();
+                }
+            });
+
+            if(block.size() != 0u) {
+                block.prepare();
+                func(block);
+            }
         }
     }
 
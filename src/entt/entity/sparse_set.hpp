@@ -1,9 +1,13 @@
 #ifndef ENTT_ENTITY_SPARSE_SET_HPP
 #define ENTT_ENTITY_SPARSE_SET_HPP
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -136,6 +140,114 @@ template<typename Container>
     return !(lhs < rhs);
 }
 
+template<typename Traits, typename = void>
+struct compressed_pages: std::false_type {};
+
+template<typename Traits>
+struct compressed_pages<Traits, std::enable_if_t<Traits::compressed_pages>>: std::true_type {};
+
+template<typename Traits, typename = void>
+struct presence_indexed: std::false_type {};
+
+template<typename Traits>
+struct presence_indexed<Traits, std::enable_if_t<Traits::presence_index>>: std::true_type {};
+
+template<typename It>
+[[nodiscard]] bool presence_pays_off(It first, It last, const std::size_t candidates) noexcept {
+    // building costs a word per 64 identifiers, it saves a lookup per candidate
+    std::size_t extent{};
+
+    if(first != last) {
+        extent = (*first)->presence_extent();
+
+        for(auto it = first; it != last; ++it) {
+            extent = (std::min)(extent, (*it)->presence_extent());
+        }
+    }
+
+    return !(candidates < extent);
+}
+
+template<typename It>
+[[nodiscard]] std::vector<std::uint64_t> presence_intersection(It first, It last) {
+    std::vector<std::uint64_t> bitset{};
+
+    if(first != last) {
+        auto extent = (*first)->presence_extent();
+
+        for(auto it = first; it != last; ++it) {
+            extent = (std::min)(extent, (*it)->presence_extent());
+        }
+
+        bitset.resize(extent, 0u);
+
+        for(std::size_t pos{}, len = (extent + 63u) / 64u; pos < len; ++pos) {
+            auto sum = ~std::uint64_t{};
+
+            for(auto it = first; it != last && sum; ++it) {
+                sum &= (*it)->presence_summary(pos);
+            }
+
+            for(auto word = pos * 64u; sum && word < extent; ++word, sum >>= 1u) {
+                if(sum & 1u) {
+                    auto value = ~std::uint64_t{};
+
+                    for(auto it = first; it != last && value; ++it) {
+                        value &= (*it)->presence_word(word);
+                    }
+
+                    bitset[word] = value;
+                }
+            }
+        }
+    }
+
+    return bitset;
+}
+
+template<typename It>
+[[nodiscard]] std::vector<std::uint64_t> presence_union(It first, It last) {
+    std::vector<std::uint64_t> bitset{};
+
+    for(; first != last; ++first) {
+        if(const auto *elem = *first; elem && elem->presence_index()) {
+            bitset.resize((std::max)(bitset.size(), elem->presence_extent()), 0u);
+
+            for(std::size_t pos{}, len = elem->presence_extent(); pos < len; ++pos) {
+                bitset[pos] |= elem->presence_word(pos);
+            }
+        } else if(elem) {
+            for(const auto entt: *elem) {
+                if(entt != tombstone) {
+                    const auto pos = static_cast<std::size_t>(entt::entt_traits<std::remove_const_t<decltype(entt)>>::to_entity(entt));
+
+                    if(!(pos / 64u < bitset.size())) {
+                        bitset.resize(pos / 64u + 1u, 0u);
+                    }
+
+                    bitset[pos / 64u] |= (std::uint64_t{1u} << (pos % 64u));
+                }
+            }
+        }
+    }
+
+    return bitset;
+}
+
+template<typename Entity>
+[[nodiscard]] bool presence_test(const std::vector<std::uint64_t> &bitset, const Entity entt) noexcept {
+    const auto pos = static_cast<std::size_t>(entt::entt_traits<Entity>::to_entity(entt));
+    return (pos / 64u < bitset.size()) && ((bitset[pos / 64u] >> (pos % 64u)) & 1u);
+}
+
+template<typename Executor, typename Func>
+void for_each_page(Executor &exec, const std::size_t first, const std::size_t last, const std::size_t page, Func func) {
+    // chunks never straddle pages, so that workers don't write to the same ones
+    exec(first / page, (last + page - 1u) / page, [first, last, page, &func](const std::size_t curr) {
+        func((std::max)(first, curr * page), (std::min)(last, (curr + 1u) * page));
+    });
+}
+
 } // namespace internal
 
 /**
@@ -159,6 +271,15 @@ template<typename Container>
  * no guarantees that entities are returned in the insertion order when iterate
  * a sparse set. Do not make assumption on the order in any case.
  *
+ * @note
+ * When the page size of the entity type is zero, the sparse array isn't paged.
+ * The whole identifier range is reserved up front as a single block and lookups
+ * don't pay for the extra indirection.
+ *
+ * @note
+ * Sparse pages can be compressed on demand. In this case, they store narrow
+ * positions rather than full identifiers.
+ *
  * @tparam Entity A valid entity type.
  * @tparam Allocator Type of allocator used to manage memory and elements.
  */
@@ -166,51 +287,249 @@ template<typename Entity, typename Allocator>
 class basic_sparse_set {
     using alloc_traits = std::allocator_traits<Allocator>;
     static_assert(std::is_same_v<typename alloc_traits::value_type, Entity>, "Invalid value type");
-    using sparse_container_type = std::vector<typename alloc_traits::pointer, typename alloc_traits::template rebind_alloc<typename alloc_traits::pointer>>;
+    // a page size of zero turns the sparse array into a single flat one
+    static constexpr bool flat_sparse = (entt_traits<Entity>::page_size == 0u);
+    // opt-in features, sets that don't use them never pay for a runtime check
+    static constexpr bool compressible = internal::compressed_pages<entt_traits<Entity>>::value;
+    static constexpr bool indexable = internal::presence_indexed<entt_traits<Entity>>::value;
+    static_assert(!(flat_sparse && compressible), "Compressed pages require a paged sparse array");
+    static_assert(!flat_sparse || !(sizeof(typename entt_traits<Entity>::entity_type) > sizeof(std::uint32_t)), "Flat sparse arrays require 32-bit identifiers at most");
+
+    using sparse_container_type = std::conditional_t<
+        flat_sparse,
+        std::vector<Entity, Allocator>,
+        std::vector<typename alloc_traits::pointer, typename alloc_traits::template rebind_alloc<typename alloc_traits::pointer>>>;
+    // compressed pages store positions only, versions are read from the packed array
+    using compressed_type = std::uint16_t;
+    using compressed_alloc_traits = typename alloc_traits::template rebind_traits<compressed_type>;
+    using compressed_container_type = std::vector<typename compressed_alloc_traits::pointer, typename alloc_traits::template rebind_alloc<typename compressed_alloc_traits::pointer>>;
     using packed_container_type = std::vector<Entity, Allocator>;
+    using bitset_container_type = std::vector<std::uint64_t, typename alloc_traits::template rebind_alloc<std::uint64_t>>;
     using underlying_type = typename entt_traits<Entity>::entity_type;
 
+    static constexpr std::size_t word_size = 64u;
+    static constexpr auto compressed_null = (std::numeric_limits<compressed_type>::max)();
+
     [[nodiscard]] auto sparse_ptr(const Entity entt) const {
         const auto pos = static_cast<size_type>(traits_type::to_entity(entt));
-        const auto page = pos / traits_type::page_size;
-        return (page < sparse.size() && sparse[page]) ? (sparse[page] + fast_mod(pos, traits_type::page_size)) : nullptr;
+
+        if constexpr(flat_sparse) {
+            return (pos < sparse.size()) ? (sparse.data() + pos) : nullptr;
+        } else {
+            const auto page = pos / traits_type::page_size;
+            return (page < sparse.size() && sparse[page]) ? (sparse[page] + fast_mod(pos, traits_type::page_size)) : nullptr;
+        }
     }
 
-    [[nodiscard]] auto &sparse_ref(const Entity entt) const {
+    [[nodiscard]] const Entity &sparse_ref(const Entity entt) const {
         ENTT_ASSERT(sparse_ptr(entt), "Invalid element");
         const auto pos = static_cast<size_type>(traits_type::to_entity(entt));
-        return sparse[pos / traits_type::page_size][fast_mod(pos, traits_type::page_size)];
+
+        if constexpr(flat_sparse) {
+            return sparse[pos];
+        } else {
+            return sparse[pos / traits_type::page_size][fast_mod(pos, traits_type::page_size)];
+        }
+    }
+
+    [[nodiscard]] Entity &sparse_ref(const Entity entt) {
+        ENTT_ASSERT(sparse_ptr(entt), "Invalid element");
+        const auto pos = static_cast<size_type>(traits_type::to_entity(entt));
+
+        if constexpr(flat_sparse) {
+            return sparse[pos];
+        } else {
+            return sparse[pos / traits_type::page_size][fast_mod(pos, traits_type::page_size)];
+        }
+    }
+
+    [[nodiscard]] compressed_type *narrow_ptr(const Entity entt) const {
+        if constexpr(flat_sparse) {
+            return nullptr;
+        } else {
+            const auto pos = static_cast<size_type>(traits_type::to_entity(entt));
+            const auto page = pos / traits_type::page_size;
+            return (page < narrow.size() && narrow[page]) ? (narrow[page] + fast_mod(pos, traits_type::page_size)) : nullptr;
+        }
+    }
+
+    [[nodiscard]] std::size_t slot_of(const Entity entt) const {
+        if(compressible && narrowed) {
+            ENTT_ASSERT(narrow_ptr(entt), "Invalid element");
+            return static_cast<size_type>(*narrow_ptr(entt));
+        }
+
+        return static_cast<size_type>(traits_type::to_entity(sparse_ref(entt)));
+    }
+
+    [[nodiscard]] bool slot_in_use(const Entity entt) const {
+        // versions of compressed pages live in the packed array, that is shuffled while sorting
+        return (compressible && narrowed) ? (narrow_ptr(entt) && (*narrow_ptr(entt) != compressed_null)) : contains(entt);
+    }
+
+    [[nodiscard]] bool slot_empty(const Entity entt) const {
+        if(compressible && narrowed) {
+            ENTT_ASSERT(narrow_ptr(entt), "Invalid element");
+            return (*narrow_ptr(entt) == compressed_null);
+        }
+
+        return (sparse_ref(entt) == null);
+    }
+
+    void slot_assign(const Entity entt, const std::size_t pos) {
+        if(compressible && narrowed) {
+            ENTT_ASSERT(narrow_ptr(entt) && (pos < compressed_null), "Invalid element");
+            *narrow_ptr(entt) = static_cast<compressed_type>(pos);
+        } else {
+            sparse_ref(entt) = traits_type::combine(static_cast<typename traits_type::entity_type>(pos), traits_type::to_integral(entt));
+        }
+    }
+
+    void slot_reset(const Entity entt) {
+        if(compressible && narrowed) {
+            ENTT_ASSERT(narrow_ptr(entt), "Invalid element");
+            *narrow_ptr(entt) = compressed_null;
+        } else {
+            sparse_ref(entt) = null;
+        }
     }
 
     [[nodiscard]] auto to_iterator(const Entity entt) const {
         return --(end() - index(entt));
     }
 
-    [[nodiscard]] auto &assure_at_least(const Entity entt) {
+    void assure_at_least(const Entity entt) {
         const auto pos = static_cast<size_type>(traits_type::to_entity(entt));
-        const auto page = pos / traits_type::page_size;
 
-        if(!(page < sparse.size())) {
-            sparse.resize(page + 1u, nullptr);
+        if constexpr(flat_sparse) {
+            if(!(pos < sparse.size())) {
+                // reserves the whole identifier range at once, memory is committed on first touch
+                sparse.reserve(static_cast<size_type>(traits_type::entity_mask) + 1u);
+                sparse.resize(pos + 1u, null);
+            }
+        } else {
+            const auto page = pos / traits_type::page_size;
+
+            if(compressible && narrowed) {
+                if(!(page < narrow.size())) {
+                    narrow.resize(page + 1u, nullptr);
+                }
+
+                if(!narrow[page]) {
+                    typename alloc_traits::template rebind_alloc<compressed_type> page_allocator{packed.get_allocator()};
+                    narrow[page] = compressed_alloc_traits::allocate(page_allocator, traits_type::page_size);
+                    std::uninitialized_fill(narrow[page], narrow[page] + traits_type::page_size, compressed_null);
+                }
+            } else {
+                if(!(page < sparse.size())) {
+                    sparse.resize(page + 1u, nullptr);
+                }
+
+                if(!sparse[page]) {
+                    auto page_allocator{packed.get_allocator()};
+                    sparse[page] = alloc_traits::allocate(page_allocator, traits_type::page_size);
+                    std::uninitialized_fill(sparse[page], sparse[page] + traits_type::page_size, null);
+                }
+            }
         }
+    }
 
-        if(!sparse[page]) {
+    void release_sparse_pages() {
+        if constexpr(!flat_sparse) {
             auto page_allocator{packed.get_allocator()};
-            sparse[page] = alloc_traits::allocate(page_allocator, traits_type::page_size);
-            std::uninitialized_fill(sparse[page], sparse[page] + traits_type::page_size, null);
+
+            for(auto &&page: sparse) {
+                if(page != nullptr) {
+                    std::destroy(page, page + traits_type::page_size);
+                    alloc_traits::deallocate(page_allocator, page, traits_type::page_size);
+                    page = nullptr;
+                }
+            }
+
+            typename alloc_traits::template rebind_alloc<compressed_type> narrow_allocator{page_allocator};
+
+            for(auto &&page: narrow) {
+                if(page != nullptr) {
+                    compressed_alloc_traits::deallocate(narrow_allocator, page, traits_type::page_size);
+                    page = nullptr;
+                }
+            }
         }
+    }
+
+    void rebuild_sparse(const bool compress) {
+        if constexpr(!flat_sparse) {
+            release_sparse_pages();
+            sparse.clear();
+            narrow.clear();
+            narrowed = compress;
 
-        return sparse[page][fast_mod(pos, traits_type::page_size)];
+            for(size_type pos{}, last = packed.size(); pos < last; ++pos) {
+                if(const auto entt = packed[pos]; entt != tombstone) {
+                    assure_at_least(entt);
+                    slot_assign(entt, pos);
+                }
+            }
+        }
     }
 
-    void release_sparse_pages() {
-        auto page_allocator{packed.get_allocator()};
+    [[nodiscard]] bool muted_test(const Entity entt) const noexcept {
+        const auto pos = static_cast<size_type>(traits_type::to_entity(entt));
+        return (pos / word_size < muted.size()) && ((muted[pos / word_size] >> fast_mod(pos, word_size)) & 1u);
+    }
+
+    void muted_flip(const Entity entt) {
+        const auto pos = static_cast<size_type>(traits_type::to_entity(entt));
+
+        if(!(pos / word_size < muted.size())) {
+            muted.resize(pos / word_size + 1u, 0u);
+        }
+
+        muted[pos / word_size] ^= (std::uint64_t{1u} << fast_mod(pos, word_size));
+    }
+
+    void presence_push(const Entity entt) {
+        ++changes;
+
+        if(indexable && indexed) {
+            const auto pos = static_cast<size_type>(traits_type::to_entity(entt));
+            const auto word = pos / word_size;
 
-        for(auto &&page: sparse) {
-            if(page != nullptr) {
-                std::destroy(page, page + traits_type::page_size);
-                alloc_traits::deallocate(page_allocator, page, traits_type::page_size);
-                page = nullptr;
+            if(!(word < presence.size())) {
+                presence.resize(word + 1u, 0u);
+                summary.resize(word / word_size + 1u, 0u);
+            }
+
+            presence[word] |= (std::uint64_t{1u} << fast_mod(pos, word_size));
+            summary[word / word_size] |= (std::uint64_t{1u} << fast_mod(word, word_size));
+        }
+    }
+
+    void presence_pop(const Entity entt) {
+        ++changes;
+
+        if(indexable && indexed) {
+            const auto pos = static_cast<size_type>(traits_type::to_entity(entt));
+            const auto word = pos / word_size;
+
+            if((presence[word] &= ~(std::uint64_t{1u} << fast_mod(pos, word_size))) == 0u) {
+                summary[word / word_size] &= ~(std::uint64_t{1u} << fast_mod(word, word_size));
+            }
+        }
+    }
+
+    template<typename It>
+    void swap_to_tail(It first, It last, const std::size_t len) {
+        const auto count = static_cast<std::size_t>(last - first);
+        const auto split = std::lower_bound(first, last, len - count);
+
+        for(auto hole = first, skip = split, pos = len - count; hole != split; ++pos) {
+            if(skip != last && *skip == pos) {
+                ++skip;
+            } else {
+                swap_or_move(pos, *hole);
+                swap_at(pos, *hole);
+                ++hole;
             }
         }
     }
@@ -219,8 +538,8 @@ class basic_sparse_set {
         auto &lhs = packed[from];
         auto &rhs = packed[to];
 
-        sparse_ref(lhs) = traits_type::combine(static_cast<typename traits_type::entity_type>(to), traits_type::to_integral(lhs));
-        sparse_ref(rhs) = traits_type::combine(static_cast<typename traits_type::entity_type>(from), traits_type::to_integral(rhs));
+        slot_assign(lhs, to);
+        slot_assign(rhs, from);
 
         std::swap(lhs, rhs);
     }
@@ -229,6 +548,47 @@ class basic_sparse_set {
         return traits_type::entity_mask * (mode != deletion_policy::swap_only);
     }
 
+    template<typename Executor, typename Func>
+    static void for_each_chunk(Executor &exec, const std::size_t length, Func func) {
+        constexpr std::size_t chunk_size = 4096u;
+
+        exec(std::size_t{}, (length + chunk_size - 1u) / chunk_size, [length, &func](const std::size_t chunk) {
+            const auto first = chunk * chunk_size;
+            func(first, (std::min)(first + chunk_size, length));
+        });
+    }
+
+    template<typename Executor, typename Container>
+    void permute(Executor &exec, const Container &from) {
+        // cycles are disjoint and are walked concurrently, one per leader
+        Container leader{from.get_allocator()};
+        std::vector<bool, typename alloc_traits::template rebind_alloc<bool>> visited(from.size(), false, packed.get_allocator());
+
+        for(std::size_t pos{}, last = from.size(); pos < last; ++pos) {
+            if(!visited[pos] && (from[pos] != pos)) {
+                leader.push_back(pos);
+
+                for(auto curr = pos; !visited[curr]; curr = from[curr]) {
+                    visited[curr] = true;
+                }
+            }
+        }
+
+        for_each_chunk(exec, leader.size(), [this, &leader, &from](const std::size_t first, const std::size_t last) {
+            for(auto pos = first; pos < last; ++pos) {
+                for(auto next = from[leader[pos]]; next != leader[pos]; next = from[next]) {
+                    swap_or_move(next, from[next]);
+                }
+            }
+        });
+
+        for_each_chunk(exec, from.size(), [this](const std::size_t first, const std::size_t last) {
+            for(auto pos = first; pos < last; ++pos) {
+                slot_assign(packed[pos], pos);
+            }
+        });
+    }
+
 private:
     virtual const void *get_at(const std::size_t) const {
         return nullptr;
@@ -242,6 +602,9 @@ protected:
     /*! @brief Random access iterator type. */
     using basic_iterator = internal::sparse_set_iterator<packed_container_type>;
 
+    /*! @brief Minimum length of the ranges that are erased in bulk. */
+    static constexpr typename basic_iterator::difference_type bulk_threshold = 16;
+
     /**
      * @brief Erases an entity from a sparse set.
      * @param it An iterator to the element to pop.
@@ -259,25 +622,88 @@ protected:
      */
     void swap_and_pop(const basic_iterator it) {
         ENTT_ASSERT(mode == deletion_policy::swap_and_pop, "Deletion policy mismatch");
-        auto &self = sparse_ref(*it);
-        const auto entt = traits_type::to_entity(self);
-        sparse_ref(packed.back()) = traits_type::combine(entt, traits_type::to_integral(packed.back()));
-        packed[static_cast<size_type>(entt)] = packed.back();
+        const auto self = *it;
+        const auto pos = slot_of(self);
+        presence_pop(self);
+        slot_assign(packed.back(), pos);
+        packed[pos] = packed.back();
         // unnecessary but it helps to detect nasty bugs
         ENTT_ASSERT((packed.back() = null, true), "");
         // lazy self-assignment guard
-        self = null;
+        slot_reset(self);
         packed.pop_back();
     }
 
+    /**
+     * @brief Moves entities to the back of a sparse set in a single pass.
+     *
+     * Elements are sorted by position and the survivors found at the back of
+     * the packed array are swapped into the holes left by the others, so that
+     * both the packed array and the payload are walked linearly.
+     *
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @return An iterator past the last element moved to the back.
+     */
+    basic_iterator swap_to_back(basic_iterator first, basic_iterator last) {
+        ENTT_ASSERT(mode == deletion_policy::swap_and_pop, "Deletion policy mismatch");
+        std::vector<size_type, typename alloc_traits::template rebind_alloc<size_type>> doomed(packed.get_allocator());
+        doomed.reserve(static_cast<size_type>(std::distance(first, last)));
+
+        for(; first != last; ++first) {
+            doomed.push_back(index(*first));
+        }
+
+        std::sort(doomed.begin(), doomed.end());
+        doomed.erase(std::unique(doomed.begin(), doomed.end()), doomed.end());
+
+        if(const auto split = std::lower_bound(doomed.begin(), doomed.end(), dormant); split != doomed.begin()) {
+            // disabled entities are enabled first, so as not to leave holes in the disabled part
+            swap_to_tail(doomed.begin(), split, dormant);
+            dormant -= static_cast<size_type>(split - doomed.begin());
+            std::iota(doomed.begin(), split, dormant);
+        }
+
+        swap_to_tail(doomed.begin(), doomed.end(), packed.size());
+        return begin() + static_cast<typename basic_iterator::difference_type>(doomed.size());
+    }
+
+    /**
+     * @brief Moves an entity out of the disabled part of a sparse set, if
+     * required.
+     * @param it An iterator to the element to move.
+     * @return An iterator to the element once moved.
+     */
+    basic_iterator activate(const basic_iterator it) {
+        if(dormant != 0u) {
+            if(const auto pos = index(*it); pos < dormant) {
+                const auto to = --dormant;
+                swap_or_move(pos, to);
+                swap_at(pos, to);
+                return --(end() - static_cast<typename basic_iterator::difference_type>(to));
+            }
+        }
+
+        return it;
+    }
+
     /**
      * @brief Erases an entity from a sparse set.
      * @param it An iterator to the element to pop.
      */
     void in_place_pop(const basic_iterator it) {
         ENTT_ASSERT(mode == deletion_policy::in_place, "Deletion policy mismatch");
-        const auto entt = traits_type::to_entity(std::exchange(sparse_ref(*it), null));
+        presence_pop(*it);
+
+        if(dormant != 0u && muted_test(*it)) {
+            muted_flip(*it);
+            --dormant;
+        }
+
+        const auto entt = static_cast<underlying_type>(slot_of(*it));
+        slot_reset(*it);
         packed[static_cast<size_type>(entt)] = traits_type::combine(std::exchange(head, entt), tombstone);
+        ++holes;
     }
 
 protected:
@@ -289,8 +715,14 @@ protected:
     virtual void pop(basic_iterator first, basic_iterator last) {
         switch(mode) {
         case deletion_policy::swap_and_pop:
-            for(; first != last; ++first) {
-                swap_and_pop(first);
+            if(std::distance(first, last) < bulk_threshold) {
+                for(; first != last; ++first) {
+                    swap_and_pop(activate(first));
+                }
+            } else {
+                for(auto it = begin(), to = swap_to_back(first, last); it != to; ++it) {
+                    swap_and_pop(it);
+                }
             }
             break;
         case deletion_policy::in_place:
@@ -300,7 +732,7 @@ protected:
             break;
         case deletion_policy::swap_only:
             for(; first != last; ++first) {
-                swap_only(first);
+                swap_only(activate(first));
             }
             break;
         }
@@ -310,10 +742,10 @@ protected:
     virtual void pop_all() {
         switch(mode) {
         case deletion_policy::in_place:
-            if(head != null) {
+            if(holes != 0u) {
                 for(auto first = begin(); !(first.index() < 0); ++first) {
                     if(*first != tombstone) {
-                        sparse_ref(*first) = null;
+                        slot_reset(*first);
                     }
                 }
                 break;
@@ -322,12 +754,19 @@ protected:
         case deletion_policy::swap_only:
         case deletion_policy::swap_and_pop:
             for(auto first = begin(); !(first.index() < 0); ++first) {
-                sparse_ref(*first) = null;
+                slot_reset(*first);
             }
             break;
         }
 
+        std::fill(presence.begin(), presence.end(), 0u);
+        std::fill(summary.begin(), summary.end(), 0u);
+        std::fill(muted.begin(), muted.end(), 0u);
         head = policy_to_head();
+        parked = traits_type::entity_mask;
+        holes = 0u;
+        dormant = 0u;
+        ++changes;
         packed.clear();
     }
 
@@ -338,36 +777,51 @@ protected:
      * @return Iterator pointing to the emplaced element.
      */
     virtual basic_iterator try_emplace(const Entity entt, const bool force_back, const void * = nullptr) {
-        auto &elem = assure_at_least(entt);
+        if(compressible && narrowed && !(packed.size() < compressed_null)) {
+            // positions no longer fit compressed pages, fall back to full ones
+            rebuild_sparse(false);
+        }
+
+        assure_at_least(entt);
         auto pos = size();
 
         switch(mode) {
         case deletion_policy::in_place:
+            if(parked != null) {
+                // parked tombstones are no longer at the back once elements are appended
+                packed[static_cast<size_type>(parked_last)] = traits_type::combine(head, tombstone);
+                head = std::exchange(parked, traits_type::entity_mask);
+            }
+
             if(head != null && !force_back) {
                 pos = static_cast<size_type>(head);
-                ENTT_ASSERT(elem == null, "Slot not available");
-                elem = traits_type::combine(head, traits_type::to_integral(entt));
+                ENTT_ASSERT(slot_empty(entt), "Slot not available");
+                slot_assign(entt, pos);
                 head = traits_type::to_entity(std::exchange(packed[pos], entt));
+                presence_push(entt);
+                --holes;
                 break;
             }
             [[fallthrough]];
         case deletion_policy::swap_and_pop:
+            ENTT_ASSERT(slot_empty(entt), "Slot not available");
             packed.push_back(entt);
-            ENTT_ASSERT(elem == null, "Slot not available");
-            elem = traits_type::combine(static_cast<typename traits_type::entity_type>(packed.size() - 1u), traits_type::to_integral(entt));
+            slot_assign(entt, packed.size() - 1u);
+            presence_push(entt);
             break;
         case deletion_policy::swap_only:
-            if(elem == null) {
+            if(slot_empty(entt)) {
                 packed.push_back(entt);
-                elem = traits_type::combine(static_cast<typename traits_type::entity_type>(packed.size() - 1u), traits_type::to_integral(entt));
+                slot_assign(entt, packed.size() - 1u);
+                presence_push(entt);
             } else {
-                ENTT_ASSERT(!(traits_type::to_entity(elem) < head), "Slot not available");
+                ENTT_ASSERT(!(slot_of(entt) < free_list()), "Slot not available");
                 bump(entt);
             }
 
             if(force_back) {
                 pos = static_cast<size_type>(head++);
-                swap_at(static_cast<size_type>(traits_type::to_entity(elem)), pos);
+                swap_at(slot_of(entt), pos);
             }
 
             break;
@@ -426,10 +880,21 @@ public:
      */
     explicit basic_sparse_set(const type_info &elem, deletion_policy pol = deletion_policy::swap_and_pop, const allocator_type &allocator = {})
         : sparse{allocator},
+          narrow{allocator},
           packed{allocator},
+          presence{allocator},
+          summary{allocator},
+          muted{allocator},
           info{&elem},
           mode{pol},
-          head{policy_to_head()} {}
+          indexed{},
+          narrowed{},
+          head{policy_to_head()},
+          parked{traits_type::entity_mask},
+          parked_last{traits_type::entity_mask},
+          holes{},
+          dormant{},
+          changes{} {}
 
     /**
      * @brief Move constructor.
@@ -437,10 +902,21 @@ public:
      */
     basic_sparse_set(basic_sparse_set &&other) noexcept
         : sparse{std::move(other.sparse)},
+          narrow{std::move(other.narrow)},
           packed{std::move(other.packed)},
+          presence{std::move(other.presence)},
+          summary{std::move(other.summary)},
+          muted{std::move(other.muted)},
           info{other.info},
           mode{other.mode},
-          head{std::exchange(other.head, policy_to_head())} {}
+          indexed{std::exchange(other.indexed, false)},
+          narrowed{std::exchange(other.narrowed, false)},
+          head{std::exchange(other.head, policy_to_head())},
+          parked{std::exchange(other.parked, traits_type::entity_mask)},
+          parked_last{other.parked_last},
+          holes{std::exchange(other.holes, 0u)},
+          dormant{std::exchange(other.dormant, 0u)},
+          changes{other.changes++} {}
 
     /**
      * @brief Allocator-extended move constructor.
@@ -449,10 +925,21 @@ public:
      */
     basic_sparse_set(basic_sparse_set &&other, const allocator_type &allocator) noexcept
         : sparse{std::move(other.sparse), allocator},
+          narrow{std::move(other.narrow), allocator},
           packed{std::move(other.packed), allocator},
+          presence{std::move(other.presence), allocator},
+          summary{std::move(other.summary), allocator},
+          muted{std::move(other.muted), allocator},
           info{other.info},
           mode{other.mode},
-          head{std::exchange(other.head, policy_to_head())} {
+          indexed{std::exchange(other.indexed, false)},
+          narrowed{std::exchange(other.narrowed, false)},
+          head{std::exchange(other.head, policy_to_head())},
+          parked{std::exchange(other.parked, traits_type::entity_mask)},
+          parked_last{other.parked_last},
+          holes{std::exchange(other.holes, 0u)},
+          dormant{std::exchange(other.dormant, 0u)},
+          changes{other.changes++} {
         ENTT_ASSERT(alloc_traits::is_always_equal::value || packed.get_allocator() == other.packed.get_allocator(), "Copying a sparse set is not allowed");
     }
 
@@ -471,10 +958,22 @@ public:
 
         release_sparse_pages();
         sparse = std::move(other.sparse);
+        narrow = std::move(other.narrow);
         packed = std::move(other.packed);
+        presence = std::move(other.presence);
+        summary = std::move(other.summary);
+        muted = std::move(other.muted);
         info = other.info;
         mode = other.mode;
+        indexed = std::exchange(other.indexed, false);
+        narrowed = std::exchange(other.narrowed, false);
         head = std::exchange(other.head, policy_to_head());
+        parked = std::exchange(other.parked, traits_type::entity_mask);
+        parked_last = other.parked_last;
+        holes = std::exchange(other.holes, 0u);
+        dormant = std::exchange(other.dormant, 0u);
+        // neither side must look unchanged to those that cached a revision
+        changes = other.changes = (std::max)(changes, other.changes) + 1u;
         return *this;
     }
 
@@ -485,10 +984,21 @@ public:
     void swap(basic_sparse_set &other) {
         using std::swap;
         swap(sparse, other.sparse);
+        swap(narrow, other.narrow);
         swap(packed, other.packed);
+        swap(presence, other.presence);
+        swap(summary, other.summary);
+        swap(muted, other.muted);
         swap(info, other.info);
         swap(mode, other.mode);
+        swap(indexed, other.indexed);
+        swap(narrowed, other.narrowed);
         swap(head, other.head);
+        swap(parked, other.parked);
+        swap(parked_last, other.parked_last);
+        swap(holes, other.holes);
+        swap(dormant, other.dormant);
+        changes = other.changes = (std::max)(changes, other.changes) + 1u;
     }
 
     /**
@@ -561,7 +1071,11 @@ public:
      * @return Extent of the sparse set.
      */
     [[nodiscard]] size_type extent() const noexcept {
-        return sparse.size() * traits_type::page_size;
+        if constexpr(flat_sparse) {
+            return sparse.size();
+        } else {
+            return ((compressible && narrowed) ? narrow.size() : sparse.size()) * traits_type::page_size;
+        }
     }
 
     /**
@@ -591,7 +1105,129 @@ public:
      * @return True if the sparse set is fully packed, false otherwise.
      */
     [[nodiscard]] bool contiguous() const noexcept {
-        return (mode != deletion_policy::in_place) || (head == null);
+        return (holes == 0u);
+    }
+
+    /**
+     * @brief Enables or disables the presence index of a sparse set.
+     *
+     * The presence index is a two-level bitset with one bit per identifier and
+     * a summary bit per word. It allows views to intersect sets a word at a
+     * time rather than by looking up entities one by one, as long as the
+     * leading set has at least a candidate per word to intersect.<br/>
+     * Enabling the index builds it from the contained entities. Disabling it
+     * releases the memory in use.
+     *
+     * @warning
+     * The presence index is available only for entity types whose traits
+     * define a `presence_index` constant set to true. Other sets don't check
+     * it on lookups at all.
+     *
+     * @param enable True to enable the presence index, false otherwise.
+     */
+    void presence_index(const bool enable) {
+        ENTT_ASSERT(!enable || indexable, "Presence index not available for this entity type");
+        presence.clear();
+        summary.clear();
+
+        if((indexed = (indexable && enable))) {
+            for(auto first = begin(); !(first.index() < 0); ++first) {
+                if(*first != tombstone) {
+                    presence_push(*first);
+                }
+            }
+        } else {
+            presence.shrink_to_fit();
+            summary.shrink_to_fit();
+        }
+    }
+
+    /**
+     * @brief Checks whether the presence index of a sparse set is enabled.
+     * @return True if the presence index is enabled, false otherwise.
+     */
+    [[nodiscard]] bool presence_index() const noexcept {
+        return indexable && indexed;
+    }
+
+    /**
+     * @brief Returns the number of words of the presence index.
+     * @return The number of words of the presence index.
+     */
+    [[nodiscard]] size_type presence_extent() const noexcept {
+        return presence.size();
+    }
+
+    /**
+     * @brief Returns a word of the presence index.
+     *
+     * The i-th bit of the word at position `pos` is set if the entity with
+     * identifier `pos * 64 + i` belongs to the sparse set, regardless of its
+     * version.
+     *
+     * @param pos The position of the word to return.
+     * @return The requested word if any, an empty word otherwise.
+     */
+    [[nodiscard]] std::uint64_t presence_word(const size_type pos) const noexcept {
+        return pos < presence.size() ? presence[pos] : std::uint64_t{};
+    }
+
+    /**
+     * @brief Returns a word of the summary of the presence index.
+     *
+     * The i-th bit of the word at position `pos` is set if the word of the
+     * presence index at position `pos * 64 + i` isn't empty.
+     *
+     * @param pos The position of the word to return.
+     * @return The requested word if any, an empty word otherwise.
+     */
+    [[nodiscard]] std::uint64_t presence_summary(const size_type pos) const noexcept {
+        return pos < summary.size() ? summary[pos] : std::uint64_t{};
+    }
+
+    /**
+     * @brief Returns the modification counter of a sparse set.
+     *
+     * The counter changes whenever entities are added to or removed from the
+     * sparse set, as well as when its content is moved or swapped. It allows
+     * users to cache data derived from a set and to detect when it's stale.
+     *
+     * @return The modification counter of the sparse set.
+     */
+    [[nodiscard]] size_type revision() const noexcept {
+        return changes;
+    }
+
+    /**
+     * @brief Enables or disables compressed sparse pages.
+     *
+     * Compressed pages store a 16-bit position per identifier rather than a
+     * full entity and versions are read from the packed array on lookup. This
+     * greatly reduces the memory footprint of small sets.<br/>
+     * Sets with more than 65534 elements cannot be compressed. If a compressed
+     * set grows past this size, it falls back to full pages on its own.
+     *
+     * @warning
+     * Compressed pages are available only for entity types whose traits define
+     * a `compressed_pages` constant set to true. Other sets don't check them on
+     * lookups at all. Compressed pages aren't available for flat sparse arrays.
+     *
+     * @param enable True to enable compressed pages, false otherwise.
+     */
+    void compressed(const bool enable) {
+        ENTT_ASSERT(!enable || compressible, "Compressed pages not available for this entity type");
+
+        if(compressible && enable != narrowed && (!enable || packed.size() < compressed_null)) {
+            rebuild_sparse(enable);
+        }
+    }
+
+    /**
+     * @brief Checks whether a sparse set uses compressed sparse pages.
+     * @return True if the sparse pages are compressed, false otherwise.
+     */
+    [[nodiscard]] bool compressed() const noexcept {
+        return compressible && narrowed;
     }
 
     /**
@@ -682,12 +1318,81 @@ public:
      * @return True if the sparse set contains the entity, false otherwise.
      */
     [[nodiscard]] bool contains(const entity_type entt) const noexcept {
+        if(const auto pos = static_cast<size_type>(traits_type::to_entity(entt)); indexable && indexed && !(presence_word(pos / word_size) & (std::uint64_t{1u} << fast_mod(pos, word_size)))) {
+            return false;
+        }
+
+        if(compressible && narrowed) {
+            const auto elem = narrow_ptr(entt);
+            return elem && (*elem != compressed_null) && (packed[*elem] == entt);
+        }
+
         const auto elem = sparse_ptr(entt);
         constexpr auto cap = traits_type::entity_mask;
         // testing versions permits to avoid accessing the packed array
         return elem && (((~cap & traits_type::to_integral(entt)) ^ traits_type::to_integral(*elem)) < cap);
     }
 
+    /**
+     * @brief Checks if a sparse set contains a block of entities.
+     *
+     * The i-th bit of the returned mask is set if the i-th entity of the range
+     * belongs to the sparse set. Lookups are performed in a tight loop that
+     * reuses the sparse page of consecutive entities, if possible.
+     *
+     * @warning
+     * Attempting to test more than 64 entities at once results in undefined
+     * behavior.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @return A bitmask of the entities contained in the sparse set.
+     */
+    template<typename It>
+    [[nodiscard]] std::uint64_t contains(It first, It last) const noexcept {
+        ENTT_ASSERT(!(std::distance(first, last) > 64), "Too many entities");
+        constexpr auto cap = traits_type::entity_mask;
+        std::uint64_t mask{};
+
+        if(compressible && narrowed) {
+            for(std::size_t bit{}; first != last; ++first, ++bit) {
+                mask |= (static_cast<std::uint64_t>(contains(*first)) << bit);
+            }
+        } else if constexpr(flat_sparse) {
+            for(std::size_t bit{}; first != last; ++first, ++bit) {
+                const auto entt = *first;
+
+                if(const auto pos = static_cast<size_type>(traits_type::to_entity(entt)); pos < sparse.size()) {
+                    // testing versions permits to avoid accessing the packed array
+                    const auto match = (((~cap & traits_type::to_integral(entt)) ^ traits_type::to_integral(sparse[pos])) < cap);
+                    mask |= (static_cast<std::uint64_t>(match) << bit);
+                }
+            }
+        } else {
+            typename sparse_container_type::value_type elem{};
+            auto curr = sparse.size();
+
+            for(std::size_t bit{}; first != last; ++first, ++bit) {
+                const auto entt = *first;
+                const auto pos = static_cast<size_type>(traits_type::to_entity(entt));
+
+                if(const auto page = pos / traits_type::page_size; page != curr) {
+                    curr = page;
+                    elem = (page < sparse.size()) ? sparse[page] : nullptr;
+                }
+
+                if(elem) {
+                    // testing versions permits to avoid accessing the packed array
+                    const auto match = (((~cap & traits_type::to_integral(entt)) ^ traits_type::to_integral(elem[fast_mod(pos, traits_type::page_size)])) < cap);
+                    mask |= (static_cast<std::uint64_t>(match) << bit);
+                }
+            }
+        }
+
+        return mask;
+    }
+
     /**
      * @brief Returns the contained version for an identifier.
      * @param entt A valid identifier.
@@ -695,11 +1400,32 @@ public:
      * version otherwise.
      */
     [[nodiscard]] version_type current(const entity_type entt) const noexcept {
-        const auto elem = sparse_ptr(entt);
         constexpr auto fallback = traits_type::to_version(tombstone);
+
+        if(compressible && narrowed) {
+            const auto elem = narrow_ptr(entt);
+            return (elem && (*elem != compressed_null)) ? traits_type::to_version(packed[*elem]) : fallback;
+        }
+
+        const auto elem = sparse_ptr(entt);
         return elem ? traits_type::to_version(*elem) : fallback;
     }
 
+    /**
+     * @brief Hints the processor to load the sparse slot of an entity.
+     *
+     * The slot itself isn't accessed and entities that don't belong to the
+     * sparse set are accepted as well. This is meant to overlap lookups that
+     * would otherwise stall on cache misses.
+     *
+     * @param entt A valid identifier.
+     */
+    void prefetch(const entity_type entt) const noexcept {
+        if(const void *elem = (compressible && narrowed) ? static_cast<const void *>(narrow_ptr(entt)) : static_cast<const void *>(sparse_ptr(entt)); elem) {
+            ENTT_PREFETCH(elem);
+        }
+    }
+
     /**
      * @brief Returns the position of an entity in a sparse set.
      *
@@ -711,8 +1437,8 @@ public:
      * @return The position of the entity in the sparse set.
      */
     [[nodiscard]] size_type index(const entity_type entt) const noexcept {
-        ENTT_ASSERT(contains(entt), "Set does not contain entity");
-        return static_cast<size_type>(traits_type::to_entity(sparse_ref(entt)));
+        ENTT_ASSERT(slot_in_use(entt), "Set does not contain entity");
+        return slot_of(entt);
     }
 
     /**
@@ -802,10 +1528,10 @@ public:
      * @return The version of the given identifier.
      */
     version_type bump(const entity_type entt) {
-        auto &entity = sparse_ref(entt);
-        ENTT_ASSERT(entt != tombstone && entity != null, "Cannot set the required version");
-        entity = traits_type::combine(traits_type::to_integral(entity), traits_type::to_integral(entt));
-        packed[static_cast<size_type>(traits_type::to_entity(entity))] = entt;
+        ENTT_ASSERT(entt != tombstone && !slot_empty(entt), "Cannot set the required version");
+        const auto pos = slot_of(entt);
+        slot_assign(entt, pos);
+        packed[pos] = entt;
         return traits_type::to_version(entt);
     }
 
@@ -836,6 +1562,16 @@ public:
     void erase(It first, It last) {
         if constexpr(std::is_same_v<It, basic_iterator>) {
             pop(first, last);
+        } else if constexpr(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>) {
+            if(std::distance(first, last) < bulk_threshold) {
+                for(; first != last; ++first) {
+                    erase(*first);
+                }
+            } else {
+                // entities are collected first, so that they are popped as a whole
+                const packed_container_type doomed(first, last, packed.get_allocator());
+                pop(basic_iterator{doomed, static_cast<typename basic_iterator::difference_type>(doomed.size())}, basic_iterator{doomed, {}});
+            }
         } else {
             for(; first != last; ++first) {
                 erase(*first);
@@ -864,19 +1600,54 @@ public:
         size_type count{};
 
         if constexpr(std::is_same_v<It, basic_iterator>) {
-            while(first != last) {
-                while(first != last && !contains(*first)) {
-                    ++first;
+            if(std::distance(first, last) < bulk_threshold) {
+                while(first != last) {
+                    while(first != last && !contains(*first)) {
+                        ++first;
+                    }
+
+                    const auto it = first;
+
+                    while(first != last && contains(*first)) {
+                        ++first;
+                    }
+
+                    count += std::distance(it, first);
+                    erase(it, first);
+                }
+            } else {
+                // entities are collected first, so that they are popped as a whole
+                packed_container_type doomed(packed.get_allocator());
+
+                for(; first != last; ++first) {
+                    if(contains(*first)) {
+                        doomed.push_back(*first);
+                    }
                 }
 
-                const auto it = first;
+                count = doomed.size();
+                pop(basic_iterator{doomed, static_cast<typename basic_iterator::difference_type>(count)}, basic_iterator{doomed, {}});
+            }
+        } else if(mode == deletion_policy::swap_and_pop) {
+            // entities are collected first, so that they are popped as a whole
+            packed_container_type doomed(packed.get_allocator());
 
-                while(first != last && contains(*first)) {
-                    ++first;
+            for(; first != last; ++first) {
+                if(contains(*first)) {
+                    doomed.push_back(*first);
                 }
+            }
 
-                count += std::distance(it, first);
-                erase(it, first);
+            if(doomed.size() < static_cast<size_type>(bulk_threshold)) {
+                for(auto entt: doomed) {
+                    count += remove(entt);
+                }
+            } else {
+                // arbitrary ranges may contain duplicates, these would be popped twice
+                std::sort(doomed.begin(), doomed.end());
+                doomed.erase(std::unique(doomed.begin(), doomed.end()), doomed.end());
+                count = doomed.size();
+                pop(basic_iterator{doomed, static_cast<typename basic_iterator::difference_type>(count)}, basic_iterator{doomed, {}});
             }
         } else {
             for(; first != last; ++first) {
@@ -900,17 +1671,178 @@ public:
                     swap_or_move(from, to);
 
                     packed[to] = packed[from];
-                    const auto entity = static_cast<typename traits_type::entity_type>(to);
-                    sparse_ref(packed[to]) = traits_type::combine(entity, traits_type::to_integral(packed[to]));
+                    slot_assign(packed[to], to);
 
                     for(; from && packed[from - 1u] == tombstone; --from) {}
                 }
             }
 
             packed.erase(packed.begin() + from, packed.end());
+            parked = traits_type::entity_mask;
+            holes = 0u;
+        }
+    }
+
+    /**
+     * @brief Removes tombstones from a sparse set, a few at a time.
+     *
+     * At most `budget` tombstones are processed per call, each one costing at
+     * most an element moved. The free list is consumed from its head, so that
+     * subsequent calls resume where the previous one stopped.<br/>
+     * The packed array is shrunk when the last tombstone is processed.
+     *
+     * @sa tombstones
+     *
+     * @param budget Maximum number of tombstones to process.
+     * @return The number of tombstones actually processed.
+     */
+    size_type compact(const size_type budget) {
+        size_type count{};
+
+        if(mode == deletion_policy::in_place) {
+            size_type from = packed.size();
+            for(; from && packed[from - 1u] == tombstone; --from) {}
+
+            // all tombstones are behind the last element, there is nothing left to fill
+            for(; (from + holes) != packed.size() && count < budget; ++count) {
+                auto to = static_cast<size_type>(head);
+                head = traits_type::to_entity(packed[to]);
+
+                if(to < from) {
+                    --from;
+                    swap_or_move(from, to);
+
+                    packed[to] = packed[from];
+                    slot_assign(packed[to], to);
+
+                    to = from;
+                    for(; from && packed[from - 1u] == tombstone; --from) {}
+                }
+
+                // tombstones left behind are parked aside, so as not to visit them again
+                parked_last = (parked == null) ? static_cast<underlying_type>(to) : parked_last;
+                packed[to] = traits_type::combine(std::exchange(parked, static_cast<underlying_type>(to)), tombstone);
+            }
+
+            if((from + holes) == packed.size()) {
+                packed.erase(packed.begin() + from, packed.end());
+                head = parked = traits_type::entity_mask;
+                holes = 0u;
+            }
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Returns the number of tombstones in a sparse set.
+     *
+     * Along with the size of the set, this gives a measure of fragmentation
+     * that can be used to decide when to compact.
+     *
+     * @return Number of tombstones in the sparse set.
+     */
+    [[nodiscard]] size_type tombstones() const noexcept {
+        return holes;
+    }
+
+    /**
+     * @brief Disables an entity without removing it from a sparse set.
+     *
+     * Disabled entities are kept at the beginning of the packed array, that is
+     * at the end of the iteration order. Views stop before reaching them, so
+     * that skipping them costs nothing and no elements are created or
+     * destroyed.<br/>
+     * Sparse sets with in-place deletion policy don't move their elements.
+     * Disabled entities are marked instead and views test them one at a time.
+     * <br/>
+     * Disabling an entity that is already disabled has no effect.
+     *
+     * @warning
+     * Attempting to disable an entity that doesn't belong to the sparse set
+     * results in undefined behavior.
+     *
+     * @param entt A valid identifier.
+     */
+    void disable(const entity_type entt) {
+        if(mode == deletion_policy::in_place) {
+            ENTT_ASSERT(contains(entt), "Set does not contain entity");
+
+            if(!muted_test(entt)) {
+                muted_flip(entt);
+                ++dormant;
+            }
+        } else if(const auto pos = index(entt); !(pos < dormant)) {
+            // basic no-leak guarantee if swapping throws
+            swap_or_move(pos, dormant);
+            swap_at(pos, dormant);
+            ++dormant;
         }
     }
 
+    /**
+     * @brief Enables an entity previously disabled.
+     *
+     * Enabling an entity that is not disabled has no effect.
+     *
+     * @warning
+     * Attempting to enable an entity that doesn't belong to the sparse set
+     * results in undefined behavior.
+     *
+     * @param entt A valid identifier.
+     */
+    void enable(const entity_type entt) {
+        if(mode == deletion_policy::in_place) {
+            ENTT_ASSERT(contains(entt), "Set does not contain entity");
+
+            if(dormant != 0u && muted_test(entt)) {
+                muted_flip(entt);
+                --dormant;
+            }
+        } else {
+            activate(to_iterator(entt));
+        }
+    }
+
+    /**
+     * @brief Checks if a sparse set contains an entity that is not disabled.
+     * @param entt A valid identifier.
+     * @return True if the sparse set contains the entity and the entity isn't
+     * disabled, false otherwise.
+     */
+    [[nodiscard]] bool enabled(const entity_type entt) const noexcept {
+        if(dormant == 0u) {
+            return contains(entt);
+        } else if(!contains(entt)) {
+            return false;
+        }
+
+        return (mode == deletion_policy::in_place) ? !muted_test(entt) : !(index(entt) < dormant);
+    }
+
+    /**
+     * @brief Returns the number of disabled entities in a sparse set.
+     * @return Number of disabled entities in the sparse set.
+     */
+    [[nodiscard]] size_type disabled() const noexcept {
+        return dormant;
+    }
+
+    /**
+     * @brief Returns the number of entities at the beginning of the packed
+     * array that are disabled.
+     *
+     * This is the number of disabled entities for all sparse sets, except for
+     * those with in-place deletion policy. The latter don't move their disabled
+     * entities and always return zero.
+     *
+     * @return Length of the disabled part of the packed array.
+     */
+    [[nodiscard]] size_type disabled_prefix() const noexcept {
+        // disabled entities aren't moved around when pointer stability is required
+        return (mode == deletion_policy::in_place) ? 0u : dormant;
+    }
+
     /**
      * @brief Swaps two entities in a sparse set.
      *
@@ -948,6 +1880,9 @@ public:
      * Moreover, the comparison function object shall induce a
      * _strict weak ordering_ on the values.
      *
+     * Disabled entities are never sorted, the first count elements are the
+     * first enabled ones.
+     *
      * The sort function object must offer a member function template
      * `operator()` that accepts three arguments:
      *
@@ -966,11 +1901,15 @@ public:
     template<typename Compare, typename Sort = std_sort, typename... Args>
     void sort_n(const size_type length, Compare compare, Sort algo = Sort{}, Args &&...args) {
         ENTT_ASSERT(!(length > packed.size()), "Length exceeds the number of elements");
-        ENTT_ASSERT((mode != deletion_policy::in_place) || (head == null), "Partial sorting with tombstones is not supported");
+        ENTT_ASSERT(holes == 0u, "Partial sorting with tombstones is not supported");
+        const auto prefix = disabled_prefix();
+        ENTT_ASSERT(!(length > packed.size() - prefix), "Length exceeds the number of enabled elements");
 
-        algo(packed.rend() - length, packed.rend(), std::move(compare), std::forward<Args>(args)...);
+        // disabled entities are at the beginning of the packed array and are never sorted
+        const auto rlast = packed.rend() - static_cast<typename packed_container_type::difference_type>(prefix);
+        algo(rlast - length, rlast, std::move(compare), std::forward<Args>(args)...);
 
-        for(size_type pos{}; pos < length; ++pos) {
+        for(size_type pos{prefix}; pos < (prefix + length); ++pos) {
             auto curr = pos;
             auto next = index(packed[curr]);
 
@@ -979,13 +1918,58 @@ public:
                 const auto entt = packed[curr];
 
                 swap_or_move(next, idx);
-                const auto entity = static_cast<typename traits_type::entity_type>(curr);
-                sparse_ref(entt) = traits_type::combine(entity, traits_type::to_integral(packed[curr]));
+                slot_assign(entt, curr);
                 curr = std::exchange(next, idx);
             }
         }
     }
 
+    /**
+     * @brief Sort the first count elements according to the given comparison
+     * function, in parallel.
+     *
+     * Elements are sorted by the given sort function object, that also receives
+     * the executor right after the comparison function. The sorted order is
+     * then applied to the sparse array and to the elements, if any, one chunk
+     * at a time on the workers of the executor.
+     *
+     * @sa sort_n
+     * @sa is_executor
+     *
+     * @warning
+     * The comparison function object is invoked concurrently from multiple
+     * workers and must be safe to call in this case.
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param exec A valid executor.
+     * @param length Number of elements to sort.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Executor, typename Compare, typename Sort = parallel_sort, typename... Args>
+    std::enable_if_t<is_executor_v<Executor>> sort_n(Executor &&exec, const size_type length, Compare compare, Sort algo = Sort{}, Args &&...args) {
+        ENTT_ASSERT(!(length > packed.size()), "Length exceeds the number of elements");
+        ENTT_ASSERT(holes == 0u, "Partial sorting with tombstones is not supported");
+        const auto prefix = disabled_prefix();
+        ENTT_ASSERT(!(length > packed.size() - prefix), "Length exceeds the number of enabled elements");
+
+        const auto rlast = packed.rend() - static_cast<typename packed_container_type::difference_type>(prefix);
+        algo(rlast - length, rlast, std::move(compare), exec, std::forward<Args>(args)...);
+        std::vector<size_type, typename alloc_traits::template rebind_alloc<size_type>> from(prefix + length, packed.get_allocator());
+
+        for_each_chunk(exec, from.size(), [this, &from, prefix](const size_type first, const size_type last) {
+            for(auto pos = first; pos < last; ++pos) {
+                from[pos] = (pos < prefix) ? pos : index(packed[pos]);
+            }
+        });
+
+        permute(exec, from);
+    }
+
     /**
      * @brief Sort all elements according to the given comparison function.
      *
@@ -999,9 +1983,30 @@ public:
      * @param args Arguments to forward to the sort function object, if any.
      */
     template<typename Compare, typename Sort = std_sort, typename... Args>
-    void sort(Compare compare, Sort algo = Sort{}, Args &&...args) {
+    std::enable_if_t<!is_executor_v<Compare>> sort(Compare compare, Sort algo = Sort{}, Args &&...args) {
         compact();
-        sort_n(packed.size(), std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        sort_n(packed.size() - disabled_prefix(), std::move(compare), std::move(algo), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Sort all elements according to the given comparison function, in
+     * parallel.
+     *
+     * @sa sort_n
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param exec A valid executor.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Executor, typename Compare, typename Sort = parallel_sort, typename... Args>
+    std::enable_if_t<is_executor_v<Executor>> sort(Executor &&exec, Compare compare, Sort algo = Sort{}, Args &&...args) {
+        compact();
+        sort_n(exec, packed.size() - disabled_prefix(), std::move(compare), std::move(algo), std::forward<Args>(args)...);
     }
 
     /**
@@ -1015,6 +2020,7 @@ public:
      * @param other The sparse sets that imposes the order of the entities.
      */
     void sort_as(const basic_sparse_set &other) {
+        ENTT_ASSERT(disabled_prefix() == 0u, "Sorting disabled entities is not supported");
         compact();
 
         const auto to = other.end();
@@ -1032,12 +2038,56 @@ public:
         }
     }
 
+    /**
+     * @brief Sort entities according to their order in another sparse set, in
+     * parallel.
+     *
+     * @sa sort_as
+     *
+     * @tparam Executor Type of executor.
+     * @param exec A valid executor.
+     * @param other The sparse sets that imposes the order of the entities.
+     */
+    template<typename Executor>
+    std::enable_if_t<is_executor_v<Executor>> sort_as(Executor &&exec, const basic_sparse_set &other) {
+        ENTT_ASSERT(disabled_prefix() == 0u, "Sorting disabled entities is not supported");
+        compact();
+
+        std::vector<size_type, typename alloc_traits::template rebind_alloc<size_type>> from(packed.size(), packed.get_allocator());
+        auto len = packed.size();
+
+        for(auto it = other.begin(), last = other.end(); it != last && len; ++it) {
+            if(contains(*it)) {
+                from[--len] = index(*it);
+            }
+        }
+
+        for(size_type pos{}, next{}; next < len; ++pos) {
+            if(!other.contains(packed[pos])) {
+                from[next++] = pos;
+            }
+        }
+
+        const packed_container_type prev{packed};
+
+        for_each_chunk(exec, packed.size(), [this, &prev, &from](const size_type first, const size_type last) {
+            for(auto pos = first; pos < last; ++pos) {
+                packed[pos] = prev[from[pos]];
+            }
+        });
+
+        permute(exec, from);
+    }
+
     /*! @brief Clears a sparse set. */
     void clear() {
         pop_all();
         // sanity check to avoid subtle issues due to storage classes
         ENTT_ASSERT((compact(), size()) == 0u, "Non-empty set");
         head = policy_to_head();
+        parked = traits_type::entity_mask;
+        holes = 0u;
+        dormant = 0u;
         packed.clear();
     }
 
@@ -1054,10 +2104,21 @@ public:
 
 private:
     sparse_container_type sparse;
+    compressed_container_type narrow;
     packed_container_type packed;
+    bitset_container_type presence;
+    bitset_container_type summary;
+    bitset_container_type muted;
     const type_info *info;
     deletion_policy mode;
+    bool indexed;
+    bool narrowed;
     underlying_type head;
+    underlying_type parked;
+    underlying_type parked_last;
+    size_type holes;
+    size_type dormant;
+    size_type changes;
 };
 
 } // namespace entt
@@ -1,8 +1,12 @@
 #ifndef ENTT_ENTITY_STORAGE_HPP
 #define ENTT_ENTITY_STORAGE_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <tuple>
 #include <type_traits>
@@ -11,6 +15,7 @@
 #include "../config/config.h"
 #include "../core/iterator.hpp"
 #include "../core/memory.hpp"
+#include "../core/type_traits.hpp"
 #include "../core/type_info.hpp"
 #include "component.hpp"
 #include "entity.hpp"
@@ -181,6 +186,10 @@ public:
         return ++(*this), orig;
     }
 
+    [[nodiscard]] constexpr extended_storage_iterator operator-(const difference_type value) const noexcept {
+        return std::apply([value](const auto &...curr) { return extended_storage_iterator{(curr - value)...}; }, it);
+    }
+
     [[nodiscard]] constexpr pointer operator->() const noexcept {
         return operator*();
     }
@@ -210,6 +219,150 @@ template<typename... Lhs, typename... Rhs>
     return !(lhs == rhs);
 }
 
+template<typename It, typename... Other>
+class soa_storage_iterator final {
+    template<typename, typename...>
+    friend class soa_storage_iterator;
+
+public:
+    using value_type = std::tuple<typename std::iterator_traits<It>::reference, typename std::iterator_traits<Other>::reference...>;
+    using pointer = input_iterator_pointer<value_type>;
+    using reference = value_type;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+
+    constexpr soa_storage_iterator() noexcept
+        : it{} {}
+
+    constexpr soa_storage_iterator(It base, Other... other) noexcept
+        : it{base, other...} {}
+
+    template<typename... Args, typename = std::enable_if_t<!std::is_same_v<std::tuple<It, Other...>, std::tuple<Args...>> && std::is_constructible_v<std::tuple<It, Other...>, const std::tuple<Args...> &>>>
+    constexpr soa_storage_iterator(const soa_storage_iterator<Args...> &other) noexcept
+        : it{other.it} {}
+
+    constexpr soa_storage_iterator &operator++() noexcept {
+        return std::apply([](auto &...curr) { (++curr, ...); }, it), *this;
+    }
+
+    constexpr soa_storage_iterator operator++(int) noexcept {
+        soa_storage_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    constexpr soa_storage_iterator &operator--() noexcept {
+        return std::apply([](auto &...curr) { (--curr, ...); }, it), *this;
+    }
+
+    constexpr soa_storage_iterator operator--(int) noexcept {
+        soa_storage_iterator orig = *this;
+        return operator--(), orig;
+    }
+
+    constexpr soa_storage_iterator &operator+=(const difference_type value) noexcept {
+        return std::apply([value](auto &...curr) { ((curr += value), ...); }, it), *this;
+    }
+
+    constexpr soa_storage_iterator operator+(const difference_type value) const noexcept {
+        soa_storage_iterator copy = *this;
+        return (copy += value);
+    }
+
+    constexpr soa_storage_iterator &operator-=(const difference_type value) noexcept {
+        return (*this += -value);
+    }
+
+    constexpr soa_storage_iterator operator-(const difference_type value) const noexcept {
+        return (*this + -value);
+    }
+
+    [[nodiscard]] constexpr reference operator[](const difference_type value) const noexcept {
+        return std::apply([value](const auto &...curr) { return reference{curr[value]...}; }, it);
+    }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept {
+        return operator*();
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+        return std::apply([](const auto &...curr) { return reference{*curr...}; }, it);
+    }
+
+    [[nodiscard]] constexpr difference_type index() const noexcept {
+        return std::get<0>(it).index();
+    }
+
+private:
+    std::tuple<It, Other...> it;
+};
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr std::ptrdiff_t operator-(const soa_storage_iterator<Lhs...> &lhs, const soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return rhs.index() - lhs.index();
+}
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr bool operator==(const soa_storage_iterator<Lhs...> &lhs, const soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return lhs.index() == rhs.index();
+}
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr bool operator!=(const soa_storage_iterator<Lhs...> &lhs, const soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr bool operator<(const soa_storage_iterator<Lhs...> &lhs, const soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return lhs.index() > rhs.index();
+}
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr bool operator>(const soa_storage_iterator<Lhs...> &lhs, const soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return rhs < lhs;
+}
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr bool operator<=(const soa_storage_iterator<Lhs...> &lhs, const soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return !(lhs > rhs);
+}
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr bool operator>=(const soa_storage_iterator<Lhs...> &lhs, const soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return !(lhs < rhs);
+}
+
+template<typename Traits, typename = void>
+struct contiguous_payload: std::false_type {};
+
+template<typename Traits>
+struct contiguous_payload<Traits, std::enable_if_t<Traits::contiguous>>: std::true_type {};
+
+template<typename Type, typename Allocator, typename = typename component_traits<Type>::soa_members>
+struct soa_storage_traits;
+
+template<typename Type, typename Allocator, auto... Member>
+struct soa_storage_traits<Type, Allocator, value_list<Member...>> {
+    template<auto Value>
+    using alloc_traits = typename std::allocator_traits<Allocator>::template rebind_traits<std::remove_reference_t<decltype(std::declval<Type &>().*Value)>>;
+
+    template<auto Value>
+    using container_type = std::vector<typename alloc_traits<Value>::pointer, typename alloc_traits<Value>::template rebind_alloc<typename alloc_traits<Value>::pointer>>;
+
+    template<auto Value, bool Const>
+    using iterator_type = storage_iterator<std::conditional_t<Const, const container_type<Value>, container_type<Value>>, component_traits<Type>::page_size>;
+
+    using payload_type = std::tuple<container_type<Member>...>;
+
+    template<bool Const>
+    using iterator = soa_storage_iterator<iterator_type<Member, Const>...>;
+
+    template<typename It, bool Const>
+    using extended_iterator = extended_storage_iterator<It, iterator_type<Member, Const>...>;
+
+    template<typename It, bool Const>
+    using extended_reverse_iterator = extended_storage_iterator<It, std::reverse_iterator<iterator_type<Member, Const>>...>;
+};
+
 } // namespace internal
 
 /**
@@ -241,12 +394,59 @@ class basic_storage: public basic_sparse_set<Entity, typename std::allocator_tra
     using underlying_iterator = typename underlying_type::basic_iterator;
 
     static constexpr bool is_pinned_type_v = !(std::is_move_constructible_v<Type> && std::is_move_assignable_v<Type>);
+    static constexpr bool is_contiguous_v = internal::contiguous_payload<component_traits<Type>>::value;
+    // a single page as large as the address space makes the payload contiguous without affecting iterators
+    static constexpr std::size_t payload_page_size = is_contiguous_v ? (std::size_t{1u} << (std::numeric_limits<std::size_t>::digits - 1)) : component_traits<Type>::page_size;
+
+    static_assert(!is_contiguous_v || !component_traits<Type>::in_place_delete, "Contiguous storage doesn't offer pointer stability");
+    static_assert(!is_contiguous_v || std::is_nothrow_move_constructible_v<Type>, "Contiguous storage requires nothrow relocatable types");
 
     [[nodiscard]] auto &element_at(const std::size_t pos) const {
-        return payload[pos / traits_type::page_size][fast_mod(pos, traits_type::page_size)];
+        return payload[pos / payload_page_size][fast_mod(pos, payload_page_size)];
+    }
+
+    void relocate(typename alloc_traits::pointer mem, const std::size_t length) noexcept {
+        allocator_type allocator{get_allocator()};
+        // the slot of an element being emplaced is past the end of the current block
+        const auto count = (std::min)({length, allocated, base_type::size()});
+
+        if(auto from = payload[0u]; from) {
+            if constexpr(std::is_trivially_copyable_v<Type>) {
+                if(count != 0u) {
+                    std::memcpy(static_cast<void *>(to_address(mem)), to_address(from), count * sizeof(Type));
+                }
+            } else {
+                for(std::size_t pos{}; pos < count; ++pos) {
+                    entt::uninitialized_construct_using_allocator(to_address(mem + pos), allocator, std::move(from[pos]));
+                    alloc_traits::destroy(allocator, to_address(from + pos));
+                }
+            }
+
+            alloc_traits::deallocate(allocator, from, allocated);
+        }
+
+        payload[0u] = mem;
+        allocated = length;
+    }
+
+    void relocate(const std::size_t length) {
+        allocator_type allocator{get_allocator()};
+        relocate(length ? alloc_traits::allocate(allocator, length) : nullptr, length);
     }
 
     auto assure_at_least(const std::size_t pos) {
+        if constexpr(is_contiguous_v) {
+            if(!(pos < allocated)) {
+                if(payload.empty()) {
+                    payload.push_back(nullptr);
+                }
+
+                relocate((std::max)(pos + 1u, allocated * 2u));
+            }
+
+            return payload[0u] + pos;
+        }
+
         const auto idx = pos / traits_type::page_size;
 
         if(!(idx < payload.size())) {
@@ -273,7 +473,30 @@ class basic_storage: public basic_sparse_set<Entity, typename std::allocator_tra
         const auto it = base_type::try_emplace(entt, force_back);
 
         ENTT_TRY {
-            auto elem = assure_at_least(static_cast<size_type>(it.index()));
+            const auto pos = static_cast<size_type>(it.index());
+
+            if constexpr(is_contiguous_v) {
+                if(!(pos < allocated)) {
+                    // arguments may refer to elements of the pool, they are moved only after the new one is built
+                    allocator_type allocator{get_allocator()};
+                    const auto length = (std::max)(pos + 1u, allocated * 2u);
+                    payload.empty() ? payload.push_back(nullptr) : void();
+                    auto mem = alloc_traits::allocate(allocator, length);
+
+                    ENTT_TRY {
+                        entt::uninitialized_construct_using_allocator(to_address(mem + pos), allocator, std::forward<Args>(args)...);
+                    }
+                    ENTT_CATCH {
+                        alloc_traits::deallocate(allocator, mem, length);
+                        ENTT_THROW;
+                    }
+
+                    relocate(mem, length);
+                    return it;
+                }
+            }
+
+            auto elem = assure_at_least(pos);
             entt::uninitialized_construct_using_allocator(to_address(elem), get_allocator(), std::forward<Args>(args)...);
         }
         ENTT_CATCH {
@@ -285,7 +508,6 @@ class basic_storage: public basic_sparse_set<Entity, typename std::allocator_tra
     }
 
     void shrink_to_size(const std::size_t sz) {
-        const auto from = (sz + traits_type::page_size - 1u) / traits_type::page_size;
         allocator_type allocator{get_allocator()};
 
         for(auto pos = sz, length = base_type::size(); pos < length; ++pos) {
@@ -298,11 +520,23 @@ class basic_storage: public basic_sparse_set<Entity, typename std::allocator_tra
             }
         }
 
-        for(auto pos = from, last = payload.size(); pos < last; ++pos) {
-            alloc_traits::deallocate(allocator, payload[pos], traits_type::page_size);
-        }
+        if constexpr(is_contiguous_v) {
+            if(sz < allocated) {
+                relocate(sz);
+            }
+
+            if(sz == 0u) {
+                payload.clear();
+            }
+        } else {
+            const auto from = (sz + traits_type::page_size - 1u) / traits_type::page_size;
 
-        payload.resize(from);
+            for(auto pos = from, last = payload.size(); pos < last; ++pos) {
+                alloc_traits::deallocate(allocator, payload[pos], traits_type::page_size);
+            }
+
+            payload.resize(from);
+        }
     }
 
 private:
@@ -338,19 +572,33 @@ protected:
      * @param last An iterator past the last element of the range of entities.
      */
     void pop(underlying_iterator first, underlying_iterator last) override {
-        for(allocator_type allocator{get_allocator()}; first != last; ++first) {
-            // cannot use first.index() because it would break with cross iterators
-            auto &elem = element_at(base_type::index(*first));
+        if constexpr(!traits_type::in_place_delete) {
+            if(!(std::distance(first, last) < base_type::bulk_threshold)) {
+                allocator_type allocator{get_allocator()};
 
+                for(auto it = base_type::begin(), to = base_type::swap_to_back(first, last); it != to; ++it) {
+                    base_type::swap_and_pop(it);
+                    alloc_traits::destroy(allocator, std::addressof(element_at(static_cast<size_type>(it.index()))));
+                }
+
+                return;
+            }
+        }
+
+        for(allocator_type allocator{get_allocator()}; first != last; ++first) {
             if constexpr(traits_type::in_place_delete) {
+                // cannot use first.index() because it would break with cross iterators
+                auto &elem = element_at(base_type::index(*first));
                 base_type::in_place_pop(first);
                 alloc_traits::destroy(allocator, std::addressof(elem));
             } else {
+                const auto it = base_type::activate(first);
+                auto &elem = element_at(base_type::index(*it));
                 auto &other = element_at(base_type::size() - 1u);
                 // destroying on exit allows reentrant destructors
                 [[maybe_unused]] auto unused = std::exchange(elem, std::move(other));
                 alloc_traits::destroy(allocator, std::addressof(other));
-                base_type::swap_and_pop(first);
+                base_type::swap_and_pop(it);
             }
         }
     }
@@ -413,9 +661,9 @@ public:
     /*! @brief Constant pointer type to contained elements. */
     using const_pointer = typename alloc_traits::template rebind_traits<typename alloc_traits::const_pointer>::const_pointer;
     /*! @brief Random access iterator type. */
-    using iterator = internal::storage_iterator<container_type, traits_type::page_size>;
+    using iterator = internal::storage_iterator<container_type, payload_page_size>;
     /*! @brief Constant random access iterator type. */
-    using const_iterator = internal::storage_iterator<const container_type, traits_type::page_size>;
+    using const_iterator = internal::storage_iterator<const container_type, payload_page_size>;
     /*! @brief Reverse iterator type. */
     using reverse_iterator = std::reverse_iterator<iterator>;
     /*! @brief Constant reverse iterator type. */
@@ -439,7 +687,8 @@ public:
      */
     explicit basic_storage(const allocator_type &allocator)
         : base_type{type_id<value_type>(), deletion_policy{traits_type::in_place_delete}, allocator},
-          payload{allocator} {}
+          payload{allocator},
+          allocated{} {}
 
     /**
      * @brief Move constructor.
@@ -447,7 +696,8 @@ public:
      */
     basic_storage(basic_storage &&other) noexcept
         : base_type{std::move(other)},
-          payload{std::move(other.payload)} {}
+          payload{std::move(other.payload)},
+          allocated{std::exchange(other.allocated, size_type{})} {}
 
     /**
      * @brief Allocator-extended move constructor.
@@ -456,7 +706,8 @@ public:
      */
     basic_storage(basic_storage &&other, const allocator_type &allocator) noexcept
         : base_type{std::move(other), allocator},
-          payload{std::move(other.payload), allocator} {
+          payload{std::move(other.payload), allocator},
+          allocated{std::exchange(other.allocated, size_type{})} {
         ENTT_ASSERT(alloc_traits::is_always_equal::value || payload.get_allocator() == other.payload.get_allocator(), "Copying a storage is not allowed");
     }
 
@@ -476,6 +727,7 @@ public:
         shrink_to_size(0u);
         base_type::operator=(std::move(other));
         payload = std::move(other.payload);
+        allocated = std::exchange(other.allocated, size_type{});
         return *this;
     }
 
@@ -487,6 +739,7 @@ public:
         using std::swap;
         base_type::swap(other);
         swap(payload, other.payload);
+        swap(allocated, other.allocated);
     }
 
     /**
@@ -518,7 +771,11 @@ public:
      * @return Capacity of the storage.
      */
     [[nodiscard]] size_type capacity() const noexcept override {
-        return payload.size() * traits_type::page_size;
+        if constexpr(is_contiguous_v) {
+            return allocated;
+        } else {
+            return payload.size() * traits_type::page_size;
+        }
     }
 
     /*! @brief Requests the removal of unused capacity. */
@@ -540,6 +797,29 @@ public:
         return payload.data();
     }
 
+    /**
+     * @brief Direct access to the contiguous array of objects.
+     *
+     * The array contains exactly `size()` objects, in the same order as the
+     * packed array of entities.
+     *
+     * @warning
+     * Only available for types with a contiguous storage.
+     *
+     * @tparam Contiguous Internal use only.
+     * @return A pointer to the array of objects, if any.
+     */
+    template<bool Contiguous = is_contiguous_v, typename = std::enable_if_t<Contiguous>>
+    [[nodiscard]] typename alloc_traits::const_pointer values() const noexcept {
+        return payload.empty() ? nullptr : payload[0u];
+    }
+
+    /*! @copydoc values */
+    template<bool Contiguous = is_contiguous_v, typename = std::enable_if_t<Contiguous>>
+    [[nodiscard]] typename alloc_traits::pointer values() noexcept {
+        return payload.empty() ? nullptr : payload[0u];
+    }
+
     /**
      * @brief Returns an iterator to the beginning.
      *
@@ -709,8 +989,9 @@ public:
      */
     template<typename It>
     iterator insert(It first, It last, const value_type &value = {}) {
-        for(; first != last; ++first) {
-            emplace_element(*first, true, value);
+        // copies the last element inserted, the value may belong to a pool that is about to relocate
+        for(const value_type *elem = &value; first != last; ++first) {
+            elem = std::addressof(element_at(static_cast<size_type>(emplace_element(*first, true, *elem).index())));
         }
 
         return begin();
@@ -773,6 +1054,7 @@ public:
 
 private:
     container_type payload;
+    size_type allocated;
 };
 
 /*! @copydoc basic_storage */
@@ -947,113 +1229,831 @@ public:
 };
 
 /**
- * @brief Swap-only entity storage specialization.
+ * @brief Structure-of-arrays storage specialization.
+ *
+ * Types that list their data members in a `soa_members` value list (either
+ * directly or through their component traits) aren't stored as a whole.<br/>
+ * Every member gets its own paged array instead, so that systems touching only
+ * a few of them stream through contiguous memory.
+ *
+ * Objects are never materialized. Getters return tuples of references to the
+ * members in the order in which they are listed. Extended iterables and the
+ * tuples returned by `get_as_tuple` contain the members _flattened_, so that
+ * views and groups forward them as if they were separate components.
+ *
+ * @warning
+ * Data members that aren't listed aren't stored. Objects rebuilt by `patch`
+ * get them default initialized and changes to them are lost once the object is
+ * split over the arrays again. Opaque access to elements through the base class
+ * isn't available for this kind of storage.
+ *
+ * @tparam Type Type of objects assigned to the entities.
  * @tparam Entity A valid entity type.
  * @tparam Allocator Type of allocator used to manage memory and elements.
  */
-template<typename Entity, typename Allocator>
-class basic_storage<Entity, Entity, Allocator>
-    : public basic_sparse_set<Entity, Allocator> {
+template<typename Type, typename Entity, typename Allocator>
+class basic_storage<Type, Entity, Allocator, std::enable_if_t<(component_traits<Type>::soa_members::size != 0u)>>
+    : public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
     using alloc_traits = std::allocator_traits<Allocator>;
-    static_assert(std::is_same_v<typename alloc_traits::value_type, Entity>, "Invalid value type");
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    using soa_traits = internal::soa_storage_traits<Type, Allocator>;
+    using container_type = typename soa_traits::payload_type;
     using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
     using underlying_iterator = typename underlying_type::basic_iterator;
-    using local_traits_type = entt_traits<Entity>;
+    using members_type = typename component_traits<Type>::soa_members;
+    using member_sequence = std::make_index_sequence<members_type::size>;
 
-    auto entity_at(const std::size_t pos) const noexcept {
-        ENTT_ASSERT(pos < local_traits_type::to_entity(null), "Invalid element");
-        return local_traits_type::combine(static_cast<typename local_traits_type::entity_type>(pos), {});
+    template<typename Container>
+    using element_traits = typename std::allocator_traits<typename Container::allocator_type>::template rebind_traits<typename std::pointer_traits<typename Container::value_type>::element_type>;
+
+    template<typename Container>
+    [[nodiscard]] static auto &element_at(Container &elem, const std::size_t pos) {
+        return elem[pos / traits_type::page_size][fast_mod(pos, traits_type::page_size)];
     }
 
-protected:
-    /**
-     * @brief Assigns an entity to a storage.
-     * @param hint A valid identifier.
-     * @return Iterator pointing to the emplaced element.
-     */
-    underlying_iterator try_emplace(const Entity hint, const bool, const void *) override {
-        return base_type::find(emplace(hint));
+    template<typename Container>
+    [[nodiscard]] static auto member_iterator_at(Container &elem, const std::ptrdiff_t pos) noexcept {
+        return internal::storage_iterator<Container, traits_type::page_size>{&elem, pos};
     }
 
-public:
-    /*! @brief Base type. */
-    using base_type = basic_sparse_set<Entity, Allocator>;
-    /*! @brief Type of the objects assigned to entities. */
-    using value_type = Entity;
-    /*! @brief Component traits. */
-    using traits_type = component_traits<value_type>;
-    /*! @brief Underlying entity identifier. */
-    using entity_type = Entity;
-    /*! @brief Unsigned integer type. */
-    using size_type = std::size_t;
-    /*! @brief Allocator type. */
-    using allocator_type = Allocator;
-    /*! @brief Extended iterable storage proxy. */
-    using iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator>>;
-    /*! @brief Constant extended iterable storage proxy. */
-    using const_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_iterator>>;
-    /*! @brief Extended reverse iterable storage proxy. */
-    using reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::reverse_iterator>>;
-    /*! @brief Constant extended reverse iterable storage proxy. */
-    using const_reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_reverse_iterator>>;
+    template<std::size_t... Index>
+    [[nodiscard]] static container_type make_payload(const Allocator &allocator, std::index_sequence<Index...>) {
+        return container_type{std::tuple_element_t<Index, container_type>{allocator}...};
+    }
 
-    /*! @brief Default constructor. */
-    basic_storage()
-        : basic_storage{allocator_type{}} {
+    template<typename Func>
+    void for_each_member(Func func) {
+        std::apply([&func](auto &...elem) { (func(elem), ...); }, payload);
     }
 
-    /**
-     * @brief Constructs an empty container with a given allocator.
-     * @param allocator The allocator to use.
-     */
-    explicit basic_storage(const allocator_type &allocator)
-        : base_type{type_id<value_type>(), deletion_policy::swap_only, allocator} {}
+    template<typename Container, typename... Args>
+    void construct_element(Container &elem, const std::size_t pos, Args &&...args) {
+        const typename element_traits<Container>::allocator_type allocator{get_allocator()};
+        entt::uninitialized_construct_using_allocator(std::addressof(element_at(elem, pos)), allocator, std::forward<Args>(args)...);
+    }
 
-    /**
-     * @brief Move constructor.
-     * @param other The instance to move from.
-     */
-    basic_storage(basic_storage &&other) noexcept
-        : base_type{std::move(other)} {}
+    template<typename Container>
+    void destroy_element(Container &elem, const std::size_t pos) {
+        typename element_traits<Container>::allocator_type allocator{get_allocator()};
+        element_traits<Container>::destroy(allocator, std::addressof(element_at(elem, pos)));
+    }
 
-    /**
-     * @brief Allocator-extended move constructor.
-     * @param other The instance to move from.
-     * @param allocator The allocator to use.
-     */
-    basic_storage(basic_storage &&other, const allocator_type &allocator) noexcept
-        : base_type{std::move(other), allocator} {}
+    void assure_at_least(const std::size_t pos) {
+        for_each_member([idx = pos / traits_type::page_size, this](auto &elem) {
+            if(!(idx < elem.size())) {
+                using traits = element_traits<std::remove_reference_t<decltype(elem)>>;
+                typename traits::allocator_type allocator{get_allocator()};
+                auto curr = elem.size();
+                elem.resize(idx + 1u, nullptr);
 
-    /**
-     * @brief Move assignment operator.
-     * @param other The instance to move from.
-     * @return This storage.
-     */
-    basic_storage &operator=(basic_storage &&other) noexcept {
-        base_type::operator=(std::move(other));
-        return *this;
+                ENTT_TRY {
+                    for(const auto last = elem.size(); curr < last; ++curr) {
+                        elem[curr] = traits::allocate(allocator, traits_type::page_size);
+                    }
+                }
+                ENTT_CATCH {
+                    elem.resize(curr);
+                    ENTT_THROW;
+                }
+            }
+        });
     }
 
-    /**
-     * @brief Returns the object assigned to an entity, that is `void`.
-     *
-     * @warning
-     * Attempting to use an entity that doesn't belong to the storage results in
-     * undefined behavior.
-     *
-     * @param entt A valid identifier.
-     */
-    void get([[maybe_unused]] const entity_type entt) const noexcept {
-        ENTT_ASSERT(base_type::index(entt) < base_type::free_list(), "The requested entity is not a live one");
+    template<typename Other, std::size_t... Index>
+    void construct_members(const std::size_t pos, Other &&value, std::index_sequence<Index...>) {
+        [[maybe_unused]] std::size_t count{};
+
+        ENTT_TRY {
+            ((construct_element(std::get<Index>(payload), pos, std::forward<Other>(value).*value_list_element_v<Index, members_type>), ++count), ...);
+        }
+        ENTT_CATCH {
+            ((Index < count ? destroy_element(std::get<Index>(payload), pos) : void()), ...);
+            ENTT_THROW;
+        }
     }
 
-    /**
-     * @brief Returns an empty tuple.
-     *
-     * @warning
-     * Attempting to use an entity that doesn't belong to the storage results in
-     * undefined behavior.
-     *
+    template<typename Other>
+    auto emplace_element(const Entity entt, const bool force_back, Other &&value) {
+        const auto it = base_type::try_emplace(entt, force_back);
+
+        ENTT_TRY {
+            const auto pos = static_cast<size_type>(it.index());
+            assure_at_least(pos);
+            construct_members(pos, std::forward<Other>(value), member_sequence{});
+        }
+        ENTT_CATCH {
+            base_type::pop(it, it + 1u);
+            ENTT_THROW;
+        }
+
+        return it;
+    }
+
+    template<std::size_t... Index>
+    void patch_members(const std::size_t pos, Type &value, std::index_sequence<Index...>) {
+        ((element_at(std::get<Index>(payload), pos) = std::move(value.*value_list_element_v<Index, members_type>)), ...);
+    }
+
+    template<std::size_t... Index>
+    [[nodiscard]] Type value_at(const std::size_t pos, std::index_sequence<Index...>) const {
+        static_assert(std::is_default_constructible_v<Type>, "Patching requires default constructible types");
+        // members are assigned by pointer, the order in which they are listed doesn't matter
+        Type value{};
+        ((value.*value_list_element_v<Index, members_type> = std::as_const(element_at(std::get<Index>(payload), pos))), ...);
+        return value;
+    }
+
+    void shrink_to_size(const std::size_t sz) {
+        for(auto pos = sz, length = base_type::size(); pos < length; ++pos) {
+            if constexpr(traits_type::in_place_delete) {
+                if(base_type::at(pos) != tombstone) {
+                    for_each_member([pos, this](auto &elem) { destroy_element(elem, pos); });
+                }
+            } else {
+                for_each_member([pos, this](auto &elem) { destroy_element(elem, pos); });
+            }
+        }
+
+        for_each_member([from = (sz + traits_type::page_size - 1u) / traits_type::page_size, this](auto &elem) {
+            using traits = element_traits<std::remove_reference_t<decltype(elem)>>;
+            typename traits::allocator_type allocator{get_allocator()};
+
+            for(auto pos = from, last = elem.size(); pos < last; ++pos) {
+                traits::deallocate(allocator, elem[pos], traits_type::page_size);
+            }
+
+            elem.resize(from);
+        });
+    }
+
+private:
+    void swap_or_move(const std::size_t from, const std::size_t to) override {
+        if constexpr(traits_type::in_place_delete) {
+            if(base_type::operator[](to) == tombstone) {
+                assure_at_least(to);
+
+                for_each_member([from, to, this](auto &elem) {
+                    construct_element(elem, to, std::move(element_at(elem, from)));
+                    destroy_element(elem, from);
+                });
+
+                return;
+            }
+        }
+
+        for_each_member([from, to](auto &elem) {
+            using std::swap;
+            swap(element_at(elem, from), element_at(elem, to));
+        });
+    }
+
+protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        if constexpr(!traits_type::in_place_delete) {
+            if(!(std::distance(first, last) < base_type::bulk_threshold)) {
+                for(auto it = base_type::begin(), to = base_type::swap_to_back(first, last); it != to; ++it) {
+                    base_type::swap_and_pop(it);
+                    for_each_member([pos = static_cast<size_type>(it.index()), this](auto &elem) { destroy_element(elem, pos); });
+                }
+
+                return;
+            }
+        }
+
+        for(; first != last; ++first) {
+            if constexpr(traits_type::in_place_delete) {
+                // cannot use first.index() because it would break with cross iterators
+                const auto pos = base_type::index(*first);
+                base_type::in_place_pop(first);
+                for_each_member([pos, this](auto &elem) { destroy_element(elem, pos); });
+            } else {
+                const auto it = base_type::activate(first);
+
+                for_each_member([pos = base_type::index(*it), back = base_type::size() - 1u, this](auto &elem) {
+                    // destroying on exit allows reentrant destructors
+                    [[maybe_unused]] auto unused = std::exchange(element_at(elem, pos), std::move(element_at(elem, back)));
+                    destroy_element(elem, back);
+                });
+
+                base_type::swap_and_pop(it);
+            }
+        }
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        for(auto first = base_type::begin(); !(first.index() < 0); ++first) {
+            const auto pos = static_cast<size_type>(first.index());
+
+            if constexpr(traits_type::in_place_delete) {
+                if(*first != tombstone) {
+                    base_type::in_place_pop(first);
+                    for_each_member([pos, this](auto &elem) { destroy_element(elem, pos); });
+                }
+            } else {
+                base_type::swap_and_pop(first);
+                for_each_member([pos, this](auto &elem) { destroy_element(elem, pos); });
+            }
+        }
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param value Optional opaque value.
+     * @param force_back Force back insertion.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace([[maybe_unused]] const Entity entt, [[maybe_unused]] const bool force_back, const void *value) override {
+        if(value) {
+            if constexpr(std::is_copy_constructible_v<value_type>) {
+                return emplace_element(entt, force_back, *static_cast<const value_type *>(value));
+            } else {
+                return base_type::end();
+            }
+        } else {
+            if constexpr(std::is_default_constructible_v<value_type>) {
+                return emplace_element(entt, force_back, value_type{});
+            } else {
+                return base_type::end();
+            }
+        }
+    }
+
+public:
+    /*! @brief Base type. */
+    using base_type = underlying_type;
+    /*! @brief Type of the objects assigned to entities. */
+    using value_type = Type;
+    /*! @brief Component traits. */
+    using traits_type = component_traits<value_type>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Random access iterator type. */
+    using iterator = typename soa_traits::template iterator<false>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = typename soa_traits::template iterator<true>;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    /*! @brief Constant reverse iterator type. */
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    /*! @brief Tuple of references to the members of an object. */
+    using reference = typename iterator::reference;
+    /*! @brief Tuple of constant references to the members of an object. */
+    using const_reference = typename const_iterator::reference;
+    /*! @brief Extended iterable storage proxy. */
+    using iterable = iterable_adaptor<typename soa_traits::template extended_iterator<typename base_type::iterator, false>>;
+    /*! @brief Constant extended iterable storage proxy. */
+    using const_iterable = iterable_adaptor<typename soa_traits::template extended_iterator<typename base_type::const_iterator, true>>;
+    /*! @brief Extended reverse iterable storage proxy. */
+    using reverse_iterable = iterable_adaptor<typename soa_traits::template extended_reverse_iterator<typename base_type::reverse_iterator, false>>;
+    /*! @brief Constant extended reverse iterable storage proxy. */
+    using const_reverse_iterable = iterable_adaptor<typename soa_traits::template extended_reverse_iterator<typename base_type::const_reverse_iterator, true>>;
+
+    /**
+     * @brief Random access iterator type for a single member.
+     * @tparam Member Data member as listed in `soa_members`.
+     */
+    template<auto Member>
+    using member_iterator = typename soa_traits::template iterator_type<Member, false>;
+
+    /**
+     * @brief Constant random access iterator type for a single member.
+     * @tparam Member Data member as listed in `soa_members`.
+     */
+    template<auto Member>
+    using const_member_iterator = typename soa_traits::template iterator_type<Member, true>;
+
+    /*! @brief Default constructor. */
+    basic_storage()
+        : basic_storage{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_storage(const allocator_type &allocator)
+        : base_type{type_id<value_type>(), deletion_policy{traits_type::in_place_delete}, allocator},
+          payload{make_payload(allocator, member_sequence{})} {}
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_storage(basic_storage &&other) noexcept
+        : base_type{std::move(other)},
+          payload{std::move(other.payload)} {}
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    basic_storage(basic_storage &&other, const allocator_type &allocator) noexcept
+        : base_type{std::move(other), allocator},
+          payload{std::move(other.payload)} {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a storage is not allowed");
+    }
+
+    /*! @brief Default destructor. */
+    ~basic_storage() override {
+        shrink_to_size(0u);
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_storage &operator=(basic_storage &&other) noexcept {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a storage is not allowed");
+
+        shrink_to_size(0u);
+        base_type::operator=(std::move(other));
+        payload = std::move(other.payload);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(basic_storage &other) {
+        using std::swap;
+        base_type::swap(other);
+        swap(payload, other.payload);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return allocator_type{base_type::get_allocator()};
+    }
+
+    /**
+     * @brief Increases the capacity of a storage.
+     *
+     * If the new capacity is greater than the current capacity, new storage is
+     * allocated, otherwise the method does nothing.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) override {
+        if(cap != 0u) {
+            base_type::reserve(cap);
+            assure_at_least(cap - 1u);
+        }
+    }
+
+    /**
+     * @brief Returns the number of elements that a storage has currently
+     * allocated space for.
+     * @return Capacity of the storage.
+     */
+    [[nodiscard]] size_type capacity() const noexcept override {
+        return std::get<0>(payload).size() * traits_type::page_size;
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() override {
+        base_type::shrink_to_fit();
+        shrink_to_size(base_type::size());
+    }
+
+    /**
+     * @brief Direct access to the pages of a single member.
+     * @tparam Member Data member as listed in `soa_members`.
+     * @return A pointer to the array of pages of the given member.
+     */
+    template<auto Member>
+    [[nodiscard]] auto raw() const noexcept {
+        return std::as_const(std::get<value_list_index_v<Member, members_type>>(payload)).data();
+    }
+
+    /*! @copydoc raw */
+    template<auto Member>
+    [[nodiscard]] auto raw() noexcept {
+        return std::get<value_list_index_v<Member, members_type>>(payload).data();
+    }
+
+    /**
+     * @brief Returns an iterable object to use to visit a single member.
+     *
+     * The iterable object is ordered as the storage and returns references to
+     * the given member only.
+     *
+     * @tparam Member Data member as listed in `soa_members`.
+     * @return An iterable object to use to visit a single member.
+     */
+    template<auto Member>
+    [[nodiscard]] iterable_adaptor<const_member_iterator<Member>> member() const noexcept {
+        const auto &elem = std::get<value_list_index_v<Member, members_type>>(payload);
+        return {const_member_iterator<Member>{&elem, static_cast<typename iterator::difference_type>(base_type::size())}, const_member_iterator<Member>{&elem, {}}};
+    }
+
+    /*! @copydoc member */
+    template<auto Member>
+    [[nodiscard]] iterable_adaptor<member_iterator<Member>> member() noexcept {
+        auto &elem = std::get<value_list_index_v<Member, members_type>>(payload);
+        return {member_iterator<Member>{&elem, static_cast<typename iterator::difference_type>(base_type::size())}, member_iterator<Member>{&elem, {}}};
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * If the storage is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first instance of the internal arrays.
+     */
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        return std::apply([pos = static_cast<typename iterator::difference_type>(base_type::size())](const auto &...elem) { return const_iterator{member_iterator_at(elem, pos)...}; }, payload);
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] iterator begin() noexcept {
+        return std::apply([pos = static_cast<typename iterator::difference_type>(base_type::size())](auto &...elem) { return iterator{member_iterator_at(elem, pos)...}; }, payload);
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator to the element following the last instance of the
+     * internal arrays.
+     */
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return std::apply([](const auto &...elem) { return const_iterator{member_iterator_at(elem, {})...}; }, payload);
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const noexcept {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    [[nodiscard]] iterator end() noexcept {
+        return std::apply([](auto &...elem) { return iterator{member_iterator_at(elem, {})...}; }, payload);
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * If the storage is empty, the returned iterator will be equal to `rend()`.
+     *
+     * @return An iterator to the first instance of the reversed internal arrays.
+     */
+    [[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+        return std::make_reverse_iterator(cend());
+    }
+
+    /*! @copydoc crbegin */
+    [[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+        return crbegin();
+    }
+
+    /*! @copydoc rbegin */
+    [[nodiscard]] reverse_iterator rbegin() noexcept {
+        return std::make_reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     * @return An iterator to the element following the last instance of the
+     * reversed internal arrays.
+     */
+    [[nodiscard]] const_reverse_iterator crend() const noexcept {
+        return std::make_reverse_iterator(cbegin());
+    }
+
+    /*! @copydoc crend */
+    [[nodiscard]] const_reverse_iterator rend() const noexcept {
+        return crend();
+    }
+
+    /*! @copydoc rend */
+    [[nodiscard]] reverse_iterator rend() noexcept {
+        return std::make_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief Returns the members of the object assigned to an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @return A tuple of references to the members of the object.
+     */
+    [[nodiscard]] const_reference get(const entity_type entt) const noexcept {
+        return cbegin()[static_cast<typename iterator::difference_type>(base_type::size() - base_type::index(entt) - 1u)];
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] reference get(const entity_type entt) noexcept {
+        return begin()[static_cast<typename iterator::difference_type>(base_type::size() - base_type::index(entt) - 1u)];
+    }
+
+    /**
+     * @brief Returns the members of the object assigned to an entity.
+     * @param entt A valid identifier.
+     * @return A tuple of references to the members of the object.
+     */
+    [[nodiscard]] const_reference get_as_tuple(const entity_type entt) const noexcept {
+        return get(entt);
+    }
+
+    /*! @copydoc get_as_tuple */
+    [[nodiscard]] reference get_as_tuple(const entity_type entt) noexcept {
+        return get(entt);
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * The object is created as a whole and then split over the arrays.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to construct an object for the entity.
+     * @return A tuple of references to the members of the newly created object.
+     */
+    template<typename... Args>
+    reference emplace(const entity_type entt, Args &&...args) {
+        if constexpr(std::is_aggregate_v<value_type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<value_type>)) {
+            emplace_element(entt, false, Type{std::forward<Args>(args)...});
+        } else {
+            emplace_element(entt, false, Type(std::forward<Args>(args)...));
+        }
+
+        return get(entt);
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     *
+     * The object is default constructed and its listed members are assigned
+     * before invoking the functions. Listed members are split over the arrays
+     * again afterwards.
+     *
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A tuple of references to the members of the updated instance.
+     */
+    template<typename... Func>
+    reference patch(const entity_type entt, Func &&...func) {
+        const auto idx = base_type::index(entt);
+        auto elem = value_at(idx, member_sequence{});
+        (std::forward<Func>(func)(elem), ...);
+        patch_members(idx, elem, member_sequence{});
+        return get(entt);
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the storage
+     * results in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the object to construct.
+     * @return Iterator pointing to the last element inserted, if any.
+     */
+    template<typename It>
+    iterator insert(It first, It last, const value_type &value = {}) {
+        for(; first != last; ++first) {
+            emplace_element(*first, true, value);
+        }
+
+        return begin();
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given range.
+     *
+     * @sa construct
+     *
+     * @tparam EIt Type of input iterator.
+     * @tparam CIt Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param from An iterator to the first element of the range of objects.
+     * @return Iterator pointing to the first element inserted, if any.
+     */
+    template<typename EIt, typename CIt, typename = std::enable_if_t<std::is_same_v<typename std::iterator_traits<CIt>::value_type, value_type>>>
+    iterator insert(EIt first, EIt last, CIt from) {
+        for(; first != last; ++first, ++from) {
+            emplace_element(*first, true, *from);
+        }
+
+        return begin();
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ a storage.
+     *
+     * The iterable object returns a tuple that contains the current entity and
+     * references to the members of its component.
+     *
+     * @return An iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] iterable each() noexcept {
+        return std::apply([this](auto &...elem) {
+            const auto pos = static_cast<typename iterator::difference_type>(base_type::size());
+            return iterable{{base_type::begin(), member_iterator_at(elem, pos)...}, {base_type::end(), member_iterator_at(elem, {})...}};
+        },
+                          payload);
+    }
+
+    /*! @copydoc each */
+    [[nodiscard]] const_iterable each() const noexcept {
+        return std::apply([this](const auto &...elem) {
+            const auto pos = static_cast<typename iterator::difference_type>(base_type::size());
+            return const_iterable{{base_type::cbegin(), member_iterator_at(elem, pos)...}, {base_type::cend(), member_iterator_at(elem, {})...}};
+        },
+                          payload);
+    }
+
+    /**
+     * @brief Returns a reverse iterable object to use to _visit_ a storage.
+     *
+     * @sa each
+     *
+     * @return A reverse iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] reverse_iterable reach() noexcept {
+        return std::apply([this](auto &...elem) {
+            const auto pos = static_cast<typename iterator::difference_type>(base_type::size());
+            return reverse_iterable{{base_type::rbegin(), std::make_reverse_iterator(member_iterator_at(elem, {}))...}, {base_type::rend(), std::make_reverse_iterator(member_iterator_at(elem, pos))...}};
+        },
+                          payload);
+    }
+
+    /*! @copydoc reach */
+    [[nodiscard]] const_reverse_iterable reach() const noexcept {
+        return std::apply([this](const auto &...elem) {
+            const auto pos = static_cast<typename iterator::difference_type>(base_type::size());
+            return const_reverse_iterable{{base_type::crbegin(), std::make_reverse_iterator(member_iterator_at(elem, {}))...}, {base_type::crend(), std::make_reverse_iterator(member_iterator_at(elem, pos))...}};
+        },
+                          payload);
+    }
+
+private:
+    container_type payload;
+};
+
+/**
+ * @brief Swap-only entity storage specialization.
+ * @tparam Entity A valid entity type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Entity, typename Allocator>
+class basic_storage<Entity, Entity, Allocator>
+    : public basic_sparse_set<Entity, Allocator> {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Entity>, "Invalid value type");
+    using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
+    using underlying_iterator = typename underlying_type::basic_iterator;
+    using local_traits_type = entt_traits<Entity>;
+
+    auto entity_at(const std::size_t pos) const noexcept {
+        ENTT_ASSERT(pos < local_traits_type::to_entity(null), "Invalid element");
+        return local_traits_type::combine(static_cast<typename local_traits_type::entity_type>(pos), {});
+    }
+
+    auto reserved_at(const std::size_t pos) const noexcept {
+        // recycled identifiers first, in the same order as emplace would return them
+        const auto from = base_type::free_list();
+        const auto recycled = base_type::size() - from;
+        return (pos < recycled) ? base_type::data()[from + pos] : entity_at(base_type::size() + (pos - recycled));
+    }
+
+protected:
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param hint A valid identifier.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace(const Entity hint, const bool, const void *) override {
+        return base_type::find(emplace(hint));
+    }
+
+public:
+    /*! @brief Base type. */
+    using base_type = basic_sparse_set<Entity, Allocator>;
+    /*! @brief Type of the objects assigned to entities. */
+    using value_type = Entity;
+    /*! @brief Component traits. */
+    using traits_type = component_traits<value_type>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Extended iterable storage proxy. */
+    using iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator>>;
+    /*! @brief Constant extended iterable storage proxy. */
+    using const_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_iterator>>;
+    /*! @brief Extended reverse iterable storage proxy. */
+    using reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::reverse_iterator>>;
+    /*! @brief Constant extended reverse iterable storage proxy. */
+    using const_reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_reverse_iterator>>;
+
+    /*! @brief Default constructor. */
+    basic_storage()
+        : basic_storage{allocator_type{}} {
+    }
+
+    /**
+     * @brief Constructs an empty container with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_storage(const allocator_type &allocator)
+        : base_type{type_id<value_type>(), deletion_policy::swap_only, allocator},
+          pending{} {}
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_storage(basic_storage &&other) noexcept
+        : base_type{std::move(other)},
+          pending{other.pending.exchange(0u, std::memory_order_relaxed)} {}
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    basic_storage(basic_storage &&other, const allocator_type &allocator) noexcept
+        : base_type{std::move(other), allocator},
+          pending{other.pending.exchange(0u, std::memory_order_relaxed)} {}
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_storage &operator=(basic_storage &&other) noexcept {
+        base_type::operator=(std::move(other));
+        pending.store(other.pending.exchange(0u, std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(basic_storage &other) {
+        base_type::swap(other);
+        pending.store(other.pending.exchange(pending.load(std::memory_order_relaxed), std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity, that is `void`.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     */
+    void get([[maybe_unused]] const entity_type entt) const noexcept {
+        ENTT_ASSERT(base_type::index(entt) < base_type::free_list(), "The requested entity is not a live one");
+    }
+
+    /**
+     * @brief Returns an empty tuple.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
      * @param entt A valid identifier.
      * @return Returns an empty tuple.
      */
@@ -1129,6 +2129,68 @@ public:
         }
     }
 
+    /**
+     * @brief Reserves an identifier, safe to call from multiple threads.
+     *
+     * Reserved identifiers are either recycled or new ones, the same that
+     * emplace would return. They become live when committed.
+     *
+     * @warning
+     * Modifying the storage in any other way between a reservation and its
+     * commit results in undefined behavior.
+     *
+     * @return An identifier that becomes valid once committed.
+     */
+    [[nodiscard]] entity_type reserve_atomic() noexcept {
+        return reserved_at(pending.fetch_add(1u, std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Reserves an identifier for each element in a range, safe to call
+     * from multiple threads.
+     *
+     * @sa reserve_atomic
+     *
+     * @tparam It Type of mutable forward iterator.
+     * @param first An iterator to the first element of the range to generate.
+     * @param last An iterator past the last element of the range to generate.
+     */
+    template<typename It>
+    void reserve_atomic(It first, It last) {
+        const auto len = static_cast<size_type>(std::distance(first, last));
+
+        for(auto pos = pending.fetch_add(len, std::memory_order_relaxed); first != last; ++first, ++pos) {
+            *first = reserved_at(pos);
+        }
+    }
+
+    /**
+     * @brief Returns the number of identifiers reserved and not yet committed.
+     * @return The number of pending reservations.
+     */
+    [[nodiscard]] size_type reserved() const noexcept {
+        return pending.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Makes all the identifiers reserved so far live.
+     *
+     * @warning
+     * This function isn't thread safe and must not be invoked while other
+     * threads reserve identifiers.
+     *
+     * @return The number of identifiers committed.
+     */
+    size_type commit_reserved() {
+        const auto len = pending.exchange(0u, std::memory_order_relaxed);
+
+        for(size_type pos{}; pos < len; ++pos) {
+            emplace();
+        }
+
+        return len;
+    }
+
     /**
      * @brief Makes all elements in a range contiguous.
      * @tparam It Type of forward iterator.
@@ -1141,6 +2203,8 @@ public:
         size_type len = base_type::free_list();
 
         for(; first != last; ++first, --len) {
+            // enabled elements only, so that the packed range never overlaps disabled ones
+            base_type::enable(*first);
             const auto pos = base_type::index(*first);
             ENTT_ASSERT(pos < base_type::free_list(), "Invalid element");
             base_type::swap_elements(base_type::data()[pos], base_type::data()[static_cast<size_type>(len - 1u)]);
@@ -1196,6 +2260,9 @@ public:
     [[nodiscard]] const_reverse_iterable reach() const noexcept {
         return {internal::extended_storage_iterator{base_type::crbegin()}, internal::extended_storage_iterator{base_type::crbegin() + base_type::free_list()}};
     }
+
+private:
+    std::atomic<size_type> pending;
 };
 
 } // namespace entt
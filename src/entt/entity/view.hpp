@@ -2,15 +2,21 @@
 #define ENTT_ENTITY_VIEW_HPP
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <memory>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
+#include "../core/algorithm.hpp"
 #include "../core/iterator.hpp"
 #include "../core/type_traits.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
+#include "sparse_set.hpp"
 
 namespace entt {
 
@@ -29,7 +35,7 @@ template<typename... Args, typename Type, std::size_t N, std::size_t... Index>
 template<typename Type, std::size_t N>
 [[nodiscard]] auto all_of(const std::array<const Type *, N> &filter, const typename Type::entity_type entt) noexcept {
     std::size_t pos{};
-    for(; pos < N && filter[pos]->contains(entt); ++pos) {}
+    for(; pos < N && filter[pos]->enabled(entt); ++pos) {}
     return pos == N;
 }
 
@@ -40,6 +46,69 @@ template<typename Type, std::size_t N>
     return pos == N;
 }
 
+template<typename Type, typename It>
+[[nodiscard]] std::uint64_t enabled_of(const Type &pool, It first, It last, std::uint64_t mask) noexcept {
+    for(std::uint64_t bit{1u}; first != last; ++first, bit <<= 1u) {
+        mask &= ((mask & bit) && !pool.enabled(*first)) ? ~bit : mask;
+    }
+
+    return mask;
+}
+
+template<typename Type, std::size_t N, typename It>
+[[nodiscard]] std::uint64_t all_of(const std::array<const Type *, N> &filter, It first, It last, std::uint64_t mask) noexcept {
+    for(std::size_t pos{}; pos < N && mask; ++pos) {
+        mask &= filter[pos]->contains(first, last);
+        // disabled entities are looked for only if there are any
+        mask = (mask && filter[pos]->disabled() != 0u) ? enabled_of(*filter[pos], first, last, mask) : mask;
+    }
+
+    return mask;
+}
+
+template<typename Type, std::size_t N, typename It>
+[[nodiscard]] std::uint64_t none_of(const std::array<const Type *, N> &filter, It first, It last, std::uint64_t mask) noexcept {
+    for(std::size_t pos{}; pos < N && mask; ++pos) {
+        mask &= filter[pos] ? ~filter[pos]->contains(first, last) : mask;
+    }
+
+    return mask;
+}
+
+template<typename Type>
+[[nodiscard]] constexpr std::size_t predicate_block_size() noexcept {
+    static_assert(Type::traits_type::page_size != 0u, "Predicates aren't supported for empty types");
+    static_assert(Type::traits_type::soa_members::size == 0u, "Predicates aren't supported for split types");
+    // blocks never straddle a page, page sizes being powers of two
+    return (Type::traits_type::page_size < 64u) ? Type::traits_type::page_size : 64u;
+}
+
+template<typename Type, typename Pred>
+[[nodiscard]] std::uint64_t predicate_mask(const Type &pool, Pred &pred, const std::size_t from, const std::size_t to) {
+    // elements of a block are contiguous, the predicate is evaluated without branches to favor vectorization
+    const auto *elem = (pool.end() - static_cast<std::ptrdiff_t>(from + 1u)).operator->();
+    std::uint64_t mask{};
+
+    if constexpr(Type::traits_type::in_place_delete) {
+        const auto *data = pool.data() + from;
+
+        for(std::size_t pos{}, len = to - from; pos < len; ++pos) {
+            mask |= static_cast<std::uint64_t>((data[pos] != tombstone) && static_cast<bool>(pred(std::as_const(elem[pos])))) << pos;
+        }
+    } else {
+        for(std::size_t pos{}, len = to - from; pos < len; ++pos) {
+            mask |= static_cast<std::uint64_t>(static_cast<bool>(pred(std::as_const(elem[pos])))) << pos;
+        }
+    }
+
+    return mask;
+}
+
+struct exclusion_bitset {
+    std::vector<std::uint64_t> bitset;
+    std::size_t stamp;
+};
+
 template<typename Type, std::size_t N>
 [[nodiscard]] auto fully_initialized(const std::array<const Type *, N> &filter) noexcept {
     std::size_t pos{};
@@ -59,8 +128,53 @@ template<typename Type, std::size_t Get, std::size_t Exclude>
 class view_iterator final {
     using iterator_type = typename Type::const_iterator;
 
-    [[nodiscard]] bool valid(const typename iterator_type::value_type entt) const noexcept {
-        return ((Get != 0u) || (entt != tombstone)) && (all_of(pools, entt)) && none_of(filter, entt);
+    // candidates are filtered in blocks to turn the lookups in tight loops
+    static constexpr typename iterator_type::difference_type block_size = 16;
+    static constexpr typename iterator_type::difference_type prefetch_distance = ENTT_VIEW_PREFETCH;
+
+    void prefetch(const iterator_type first, const iterator_type to) const noexcept {
+        for(auto curr = first; curr != to && (last - curr) > prefetch_distance; ++curr) {
+            const auto entt = *(curr + prefetch_distance);
+
+            for(auto *elem: pools) {
+                elem->prefetch(entt);
+            }
+
+            for(auto *elem: filter) {
+                elem ? elem->prefetch(entt) : void();
+            }
+        }
+    }
+
+    [[nodiscard]] std::uint64_t valid(const iterator_type first, const iterator_type to) const noexcept {
+        std::uint64_t result = (std::uint64_t{1u} << (to - first)) - 1u;
+
+        if constexpr(Get == 0u) {
+            std::uint64_t bit{1u};
+
+            for(auto curr = first; curr != to; ++curr, bit <<= 1u) {
+                result &= (*curr == tombstone) ? ~bit : result;
+            }
+        }
+
+        // storage with in-place deletion policy don't move their disabled entities
+        result = lead ? enabled_of(*lead, first, to, result) : result;
+        return none_of(filter, first, to, all_of(pools, first, to, result));
+    }
+
+    void seek() noexcept {
+        while(!mask && (it = stop) != last) {
+            const auto len = last - it;
+            stop = it + (len < block_size ? len : block_size);
+
+            if constexpr(prefetch_distance != 0) {
+                prefetch(it, stop);
+            }
+
+            mask = valid(it, stop);
+        }
+
+        for(; mask && !(mask & 1u); mask >>= 1u, ++it) {}
     }
 
 public:
@@ -73,22 +187,25 @@ public:
     constexpr view_iterator() noexcept
         : it{},
           last{},
+          stop{},
+          mask{},
+          lead{},
           pools{},
           filter{} {}
 
-    view_iterator(iterator_type curr, iterator_type to, std::array<const Type *, Get> value, std::array<const Type *, Exclude> excl) noexcept
+    view_iterator(iterator_type curr, iterator_type to, const Type *muted, std::array<const Type *, Get> value, std::array<const Type *, Exclude> excl) noexcept
         : it{curr},
           last{to},
+          stop{curr},
+          mask{},
+          lead{muted},
           pools{value},
           filter{excl} {
-        while(it != last && !valid(*it)) {
-            ++it;
-        }
+        seek();
     }
 
     view_iterator &operator++() noexcept {
-        while(++it != last && !valid(*it)) {}
-        return *this;
+        return ++it, mask >>= 1u, seek(), *this;
     }
 
     view_iterator operator++(int) noexcept {
@@ -110,6 +227,9 @@ public:
 private:
     iterator_type it;
     iterator_type last;
+    iterator_type stop;
+    std::uint64_t mask;
+    const Type *lead;
     std::array<const Type *, Get> pools;
     std::array<const Type *, Exclude> filter;
 };
@@ -237,11 +357,55 @@ class basic_view<get_t<Get...>, exclude_t<Exclude...>> {
         return other;
     }
 
+    [[nodiscard]] auto last() const noexcept {
+        // disabled entities are at the end of the iteration order
+        return view->end() - static_cast<typename common_type::iterator::difference_type>(view->disabled_prefix());
+    }
+
+    [[nodiscard]] const base_type *muted() const noexcept {
+        // disabled entities that aren't at the end of the iteration order are tested one at a time
+        return (view->disabled() != view->disabled_prefix()) ? view : nullptr;
+    }
+
+    template<std::size_t... Index>
+    [[nodiscard]] bool muting(std::index_sequence<Index...>) const noexcept {
+        return ((std::get<Index>(pools)->disabled() != 0u) || ...);
+    }
+
+    template<bool Muted>
+    [[nodiscard]] static bool member(const base_type &pool, const underlying_type entt) noexcept {
+        if constexpr(Muted) {
+            return pool.enabled(entt);
+        } else {
+            return pool.contains(entt);
+        }
+    }
+
     void unchecked_refresh() noexcept {
         view = std::get<0>(pools);
         std::apply([this](auto *, auto *...other) { ((this->view = other->size() < this->view->size() ? other : this->view), ...); }, pools);
     }
 
+    [[nodiscard]] std::size_t revision() const noexcept {
+        std::size_t sum{};
+
+        for(auto *elem: filter) {
+            sum += elem ? elem->revision() : 0u;
+        }
+
+        return sum;
+    }
+
+    [[nodiscard]] const std::vector<std::uint64_t> *exclusion() const noexcept {
+        // revisions only ever grow, a stale cache never matches their sum
+        return ((sizeof...(Exclude) != 0u) && exclusion_cache()) ? &cache->bitset : nullptr;
+    }
+
+    [[nodiscard]] bool excluded(const std::vector<std::uint64_t> *elem, const underlying_type entt) const noexcept {
+        // the cache knows identifiers only, versions are checked against the storage
+        return (!elem || internal::presence_test(*elem, entt)) && !internal::none_of(filter, entt);
+    }
+
     template<std::size_t Curr, std::size_t Other, typename... Args>
     [[nodiscard]] auto dispatch_get(const std::tuple<underlying_type, Args...> &curr) const {
         if constexpr(Curr == Other) {
@@ -251,10 +415,63 @@ class basic_view<get_t<Get...>, exclude_t<Exclude...>> {
         }
     }
 
+    [[nodiscard]] std::size_t length() const noexcept {
+        return (view->policy() == deletion_policy::swap_only) ? view->free_list() : view->size();
+    }
+
+    template<std::size_t Curr, std::size_t... Index>
+    [[nodiscard]] bool presence(std::vector<std::uint64_t> &bitset, std::index_sequence<Index...>) const {
+        // intersects presence indexes a word at a time when all pools offer one and there are enough candidates
+        if((sizeof...(Get) != 1u) && ((Curr == Index || std::get<Index>(pools)->presence_index()) && ...)) {
+            std::array<const common_type *, sizeof...(Get)> other{std::get<Index>(pools)...};
+            std::swap(other[Curr], other.back());
+
+            if(internal::presence_pays_off(other.begin(), other.end() - 1u, length() - view->disabled_prefix())) {
+                bitset = internal::presence_intersection(other.begin(), other.end() - 1u);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     template<std::size_t Curr, typename Func, std::size_t... Index>
-    void each(Func &func, std::index_sequence<Index...>) const {
-        for(const auto curr: std::get<Curr>(pools)->each()) {
-            if(const auto entt = std::get<0>(curr); ((sizeof...(Get) != 1u) || (entt != tombstone)) && ((Curr == Index || std::get<Index>(pools)->contains(entt)) && ...) && internal::none_of(filter, entt)) {
+    void each(Func &func, std::index_sequence<Index...> seq) const {
+        std::vector<std::uint64_t> bitset{};
+        const bool indexed = presence<Curr>(bitset, seq);
+        // disabled entities are looked for only if there are any, the check is hoisted out of the loop
+        muting(seq) ? each<Curr, true>(func, view->disabled_prefix(), length(), indexed ? &bitset : nullptr, seq) : each<Curr, false>(func, view->disabled_prefix(), length(), indexed ? &bitset : nullptr, seq);
+    }
+
+    template<std::size_t Curr, typename Executor, typename Func, std::size_t... Index>
+    void each(Executor &exec, Func &func, std::index_sequence<Index...> seq) const {
+        using leading_type = type_list_element_t<Curr, type_list<Get...>>;
+        constexpr std::size_t page = (leading_type::traits_type::page_size == 0u) ? ENTT_PACKED_PAGE : leading_type::traits_type::page_size;
+        [[maybe_unused]] const auto len = view->size();
+        std::vector<std::uint64_t> bitset{};
+        const bool indexed = presence<Curr>(bitset, seq);
+
+        internal::for_each_page(exec, view->disabled_prefix(), length(), page, [this, &func, elem = indexed ? &bitset : nullptr, muted = muting(seq), seq](const std::size_t from, const std::size_t to) {
+            muted ? each<Curr, true>(func, from, to, elem, seq) : each<Curr, false>(func, from, to, elem, seq);
+        });
+
+        ENTT_ASSERT(len == view->size(), "Structural changes are not allowed");
+    }
+
+    template<std::size_t Curr, bool Muted, typename Func, std::size_t... Index>
+    void each(Func &func, const std::size_t from, const std::size_t to, const std::vector<std::uint64_t> *bitset, std::index_sequence<Index...>) const {
+        const auto range = std::get<Curr>(pools)->each();
+        const auto *lead = muted();
+        const auto *excl = exclusion();
+
+        for(auto first = range.end() - static_cast<std::ptrdiff_t>(to), last = range.end() - static_cast<std::ptrdiff_t>(from); first != last; ++first) {
+            if constexpr(ENTT_VIEW_PREFETCH != 0) {
+                prefetch<Curr>(static_cast<std::size_t>(first.base().index()), std::index_sequence<Index...>{});
+            }
+
+            const auto curr = *first;
+
+            if(const auto entt = std::get<0>(curr); ((sizeof...(Get) != 1u) || (entt != tombstone)) && (!Muted || !lead || lead->enabled(entt)) && (!bitset || internal::presence_test(*bitset, entt)) && ((Curr == Index || member<Muted>(*std::get<Index>(pools), entt)) && ...) && !excluded(excl, entt)) {
                 if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
                     std::apply(func, std::tuple_cat(std::make_tuple(entt), dispatch_get<Curr, Index>(curr)...));
                 } else {
@@ -264,11 +481,61 @@ class basic_view<get_t<Get...>, exclude_t<Exclude...>> {
         }
     }
 
+    template<std::size_t Curr, std::size_t... Index>
+    void prefetch(const std::size_t pos, std::index_sequence<Index...>) const noexcept {
+        // only sparse slots, looking up elements would stall on the very loads to hide
+        constexpr std::size_t distance = ENTT_VIEW_PREFETCH;
+
+        if(!(pos < distance)) {
+            const auto entt = std::get<Curr>(pools)->data()[pos - distance];
+            ((Curr == Index ? void() : std::get<Index>(pools)->prefetch(entt)), ...);
+
+            for(auto *elem: filter) {
+                elem ? elem->prefetch(entt) : void();
+            }
+        }
+    }
+
+    template<std::size_t Curr, bool Muted, typename Pred, typename Func, std::size_t... Index>
+    void each_if(Pred &pred, Func &func, std::index_sequence<Index...>) const {
+        using predicate_type = type_list_element_t<Curr, type_list<Get...>>;
+        constexpr auto width = internal::predicate_block_size<predicate_type>();
+        const auto *cpool = std::get<Curr>(pools);
+        const auto *data = cpool->data();
+
+        const auto *lead = (cpool->disabled() != cpool->disabled_prefix()) ? cpool : nullptr;
+        const auto *excl = exclusion();
+
+        for(auto to = cpool->size(), first = cpool->disabled_prefix(); to != first;) {
+            const auto from = ((to - 1u) / width * width < first) ? first : ((to - 1u) / width * width);
+            const auto mask = internal::predicate_mask(*cpool, pred, from, to);
+
+            for(auto pos = to; pos != from;) {
+                if(--pos; (mask >> (pos - from)) & 1u) {
+                    if(const auto entt = data[pos]; (!Muted || !lead || lead->enabled(entt)) && ((Curr == Index || member<Muted>(*std::get<Index>(pools), entt)) && ...) && !excluded(excl, entt)) {
+                        if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+                            std::apply(func, std::tuple_cat(std::make_tuple(entt), get(entt)));
+                        } else {
+                            std::apply(func, get(entt));
+                        }
+                    }
+                }
+            }
+
+            to = from;
+        }
+    }
+
     template<typename Func, std::size_t... Index>
     void pick_and_each(Func &func, std::index_sequence<Index...> seq) const {
         ((std::get<Index>(pools) == view ? each<Index>(func, seq) : void()), ...);
     }
 
+    template<typename Executor, typename Func, std::size_t... Index>
+    void pick_and_each(Executor &exec, Func &func, std::index_sequence<Index...> seq) const {
+        ((std::get<Index>(pools) == view ? each<Index>(exec, func, seq) : void()), ...);
+    }
+
 public:
     /*! @brief Common type among all storage types. */
     using common_type = base_type;
@@ -285,7 +552,8 @@ public:
     basic_view() noexcept
         : pools{},
           filter{},
-          view{} {}
+          view{},
+          cache{} {}
 
     /**
      * @brief Constructs a view from a set of storage classes.
@@ -295,7 +563,8 @@ public:
     basic_view(Get &...value, Exclude &...excl) noexcept
         : pools{&value...},
           filter{&excl...},
-          view{} {
+          view{},
+          cache{} {
         unchecked_refresh();
     }
 
@@ -334,6 +603,40 @@ public:
         }
     }
 
+    /**
+     * @brief Enables or disables the exclusion cache of a view.
+     *
+     * The exclusion cache is a bitset with one bit per identifier, set for all
+     * the entities that belong to at least one of the storage used to filter
+     * the view. It spares the each functions that accept a function object an
+     * existence check per storage for all the entities that don't belong to
+     * any of them. The cache only knows identifiers, therefore entities whose
+     * identifier is cached are still looked up to compare versions.<br/>
+     * The cache is used only as long as the storage used to filter the view
+     * aren't modified, otherwise views fall back to regular lookups. Enabling
+     * the cache again rebuilds it if it's out of date.<br/>
+     * Copies of a view share its cache rather than duplicating it. Rebuilding
+     * the cache of a view doesn't affect the copies made in the meantime.
+     *
+     * @param enable True to enable the exclusion cache, false otherwise.
+     */
+    void exclusion_cache(const bool enable) {
+        if(!enable) {
+            cache.reset();
+        } else if(!exclusion_cache()) {
+            cache = std::make_shared<const internal::exclusion_bitset>(internal::exclusion_bitset{internal::presence_union(filter.cbegin(), filter.cend()), revision()});
+        }
+    }
+
+    /**
+     * @brief Checks whether a view has an up to date exclusion cache.
+     * @return True if the exclusion cache is enabled and up to date, false
+     * otherwise.
+     */
+    [[nodiscard]] bool exclusion_cache() const noexcept {
+        return cache && (cache->stamp == revision());
+    }
+
     /**
      * @brief Returns the leading storage of a view, if any.
      * @return The leading storage of the view.
@@ -385,6 +688,7 @@ public:
             refresh();
         } else {
             std::get<Index - sizeof...(Get)>(filter) = &elem;
+            cache.reset();
         }
     }
 
@@ -404,7 +708,7 @@ public:
      * @return An iterator to the first entity of the view.
      */
     [[nodiscard]] iterator begin() const noexcept {
-        return view ? iterator{view->begin(), view->end(), opaque_check_set(), filter} : iterator{};
+        return view ? iterator{view->begin(), last(), muted(), opaque_check_set(), filter} : iterator{};
     }
 
     /**
@@ -412,7 +716,7 @@ public:
      * @return An iterator to the entity following the last entity of the view.
      */
     [[nodiscard]] iterator end() const noexcept {
-        return view ? iterator{view->end(), view->end(), opaque_check_set(), filter} : iterator{};
+        return view ? iterator{last(), last(), muted(), opaque_check_set(), filter} : iterator{};
     }
 
     /**
@@ -432,8 +736,8 @@ public:
      */
     [[nodiscard]] entity_type back() const noexcept {
         if(view) {
-            auto it = view->rbegin();
-            for(const auto last = view->rend(); it != last && !contains(*it); ++it) {}
+            auto it = view->rbegin() + static_cast<typename common_type::iterator::difference_type>(view->disabled_prefix());
+            for(const auto to = view->rend(); it != to && !contains(*it); ++it) {}
             return it == view->rend() ? null : *it;
         }
 
@@ -447,7 +751,7 @@ public:
      * iterator otherwise.
      */
     [[nodiscard]] iterator find(const entity_type entt) const noexcept {
-        return contains(entt) ? iterator{view->find(entt), view->end(), opaque_check_set(), filter} : end();
+        return contains(entt) ? iterator{view->find(entt), last(), muted(), opaque_check_set(), filter} : end();
     }
 
     /**
@@ -473,7 +777,7 @@ public:
      * @return True if the view contains the given entity, false otherwise.
      */
     [[nodiscard]] bool contains(const entity_type entt) const noexcept {
-        return view && std::apply([entt](const auto *...curr) { return (curr->contains(entt) && ...); }, pools) && internal::none_of(filter, entt);
+        return view && std::apply([entt](const auto *...curr) { return (curr->enabled(entt) && ...); }, pools) && internal::none_of(filter, entt);
     }
 
     /**
@@ -525,6 +829,67 @@ public:
         view ? pick_and_each(func, std::index_sequence_for<Get...>{}) : void();
     }
 
+    /**
+     * @brief Iterates entities and components for which a predicate holds and
+     * applies the given function object to them.
+     *
+     * The predicate is invoked with constant references to the elements of
+     * the given type, that are tested in blocks directly from their storage.
+     * Simple predicates on data members are therefore likely to be vectorized
+     * by the compiler. Only the entities that pass the test are looked up in
+     * the other storage.<br/>
+     * The signature of the predicate should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * bool(const Type &);
+     * @endcode
+     *
+     * The signature of the function must be equivalent to one of those of the
+     * `each` member function.
+     *
+     * @sa each
+     *
+     * @tparam Type Type of component to test.
+     * @tparam Pred Type of predicate.
+     * @tparam Func Type of the function object to invoke.
+     * @param pred A valid predicate.
+     * @param func A valid function object.
+     */
+    template<typename Type, typename Pred, typename Func>
+    void each_if(Pred pred, Func func) const {
+        static_assert(index_of<Type> < sizeof...(Get), "Predicates only apply to iterated types");
+        if(const auto seq = std::index_sequence_for<Get...>{}; view) {
+            muting(seq) ? each_if<index_of<Type>, true>(pred, func, seq) : each_if<index_of<Type>, false>(pred, func, seq);
+        }
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The entities of the leading storage are split in chunks that never
+     * straddle a page and the chunks are spread over the workers of the given
+     * executor. The function object is invoked concurrently, therefore it must
+     * be safe to do so.
+     *
+     * @warning
+     * Only reading and modifying the components in place is allowed during
+     * iterations. Creating or destroying entities and components, as well as
+     * sorting, results in undefined behavior.
+     *
+     * @sa each
+     * @sa is_executor
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param exec A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    std::enable_if_t<is_executor_v<Executor>> each(Executor &&exec, Func func) const {
+        view ? pick_and_each(exec, func, std::index_sequence_for<Get...>{}) : void();
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ a view.
      *
@@ -536,11 +901,11 @@ public:
      */
     [[nodiscard]] iterable each() const noexcept {
         if(view) {
-            const auto len = (view->policy() == deletion_policy::swap_only) ? view->free_list() : view->size();
             const auto check_set = opaque_check_set();
-            const auto it = view->end();
+            const auto it = last();
+            const auto *lead = muted();
 
-            return {internal::extended_view_iterator{iterator{it - len, it, check_set, filter}, pools}, internal::extended_view_iterator{iterator{it, it, check_set, filter}, pools}};
+            return {internal::extended_view_iterator{iterator{view->end() - length(), it, lead, check_set, filter}, pools}, internal::extended_view_iterator{iterator{it, it, lead, check_set, filter}, pools}};
         }
 
         return iterable{};
@@ -565,6 +930,7 @@ private:
     std::tuple<Get *...> pools;
     std::array<const common_type *, sizeof...(Exclude)> filter;
     const common_type *view;
+    std::shared_ptr<const internal::exclusion_bitset> cache;
 };
 
 /**
@@ -668,7 +1034,7 @@ public:
      * @return Number of entities that have the given component.
      */
     [[nodiscard]] size_type size() const noexcept {
-        return handle() ? handle()->size() : size_type{};
+        return handle() ? (handle()->size() - handle()->disabled()) : size_type{};
     }
 
     /**
@@ -676,7 +1042,7 @@ public:
      * @return True if the view is empty, false otherwise.
      */
     [[nodiscard]] bool empty() const noexcept {
-        return !handle() || handle()->empty();
+        return (size() == 0u);
     }
 
     /**
@@ -695,7 +1061,7 @@ public:
      * @return An iterator to the entity following the last entity of the view.
      */
     [[nodiscard]] iterator end() const noexcept {
-        return handle() ? handle()->end() : iterator{};
+        return handle() ? (handle()->end() - static_cast<typename iterator::difference_type>(handle()->disabled())) : iterator{};
     }
 
     /**
@@ -706,7 +1072,7 @@ public:
      * @return An iterator to the first entity of the reversed view.
      */
     [[nodiscard]] reverse_iterator rbegin() const noexcept {
-        return handle() ? handle()->rbegin() : reverse_iterator{};
+        return handle() ? (handle()->rbegin() + static_cast<typename iterator::difference_type>(handle()->disabled())) : reverse_iterator{};
     }
 
     /**
@@ -734,7 +1100,7 @@ public:
      * otherwise.
      */
     [[nodiscard]] entity_type back() const noexcept {
-        return empty() ? null : *handle()->rbegin();
+        return empty() ? null : *rbegin();
     }
 
     /**
@@ -744,7 +1110,7 @@ public:
      * iterator otherwise.
      */
     [[nodiscard]] iterator find(const entity_type entt) const noexcept {
-        return handle() ? handle()->find(entt) : iterator{};
+        return contains(entt) ? handle()->find(entt) : end();
     }
 
     /**
@@ -779,7 +1145,7 @@ public:
      * @return True if the view contains the given entity, false otherwise.
      */
     [[nodiscard]] bool contains(const entity_type entt) const noexcept {
-        return handle() && handle()->contains(entt);
+        return handle() && handle()->enabled(entt);
     }
 
     /**
@@ -828,7 +1194,7 @@ public:
     void each(Func func) const {
         if(auto *view = storage(); view) {
             if constexpr(is_applicable_v<Func, decltype(*view->each().begin())>) {
-                for(const auto pack: view->each()) {
+                for(const auto pack: each()) {
                     std::apply(func, pack);
                 }
             } else if constexpr(Get::traits_type::page_size == 0u) {
@@ -836,13 +1202,114 @@ public:
                     func();
                 }
             } else {
-                for(auto &&component: *view) {
-                    func(component);
+                for(auto first = view->begin(), last = view->end() - static_cast<std::ptrdiff_t>(view->disabled()); first != last; ++first) {
+                    func(*first);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Iterates entities and components for which a predicate holds and
+     * applies the given function object to them.
+     *
+     * The predicate is invoked with constant references to the elements, that
+     * are tested in blocks directly from the storage. Simple predicates on data
+     * members are therefore likely to be vectorized by the compiler.<br/>
+     * The signature of the predicate should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * bool(const Type &);
+     * @endcode
+     *
+     * The signature of the function must be equivalent to one of those of the
+     * `each` member function.
+     *
+     * @sa each
+     *
+     * @tparam Pred Type of predicate.
+     * @tparam Func Type of the function object to invoke.
+     * @param pred A valid predicate.
+     * @param func A valid function object.
+     */
+    template<typename Pred, typename Func>
+    void each_if(Pred pred, Func func) const {
+        if(auto *view = storage(); view) {
+            constexpr auto width = internal::predicate_block_size<Get>();
+            const auto *data = view->data();
+
+            for(auto to = view->size(), first = view->disabled(); to != first;) {
+                const auto from = ((to - 1u) / width * width < first) ? first : ((to - 1u) / width * width);
+                const auto mask = internal::predicate_mask(*view, pred, from, to);
+
+                for(auto pos = to; pos != from;) {
+                    if(--pos; (mask >> (pos - from)) & 1u) {
+                        auto &elem = *(view->end() - static_cast<std::ptrdiff_t>(pos + 1u));
+
+                        if constexpr(std::is_invocable_v<Func, entity_type, decltype(elem)>) {
+                            func(data[pos], elem);
+                        } else {
+                            func(elem);
+                        }
+                    }
                 }
+
+                to = from;
             }
         }
     }
 
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The entities of the view are split in chunks that never straddle a page
+     * and the chunks are spread over the workers of the given executor. The
+     * function object is invoked concurrently, therefore it must be safe to do
+     * so.
+     *
+     * @warning
+     * Only reading and modifying the components in place is allowed during
+     * iterations. Creating or destroying entities and components, as well as
+     * sorting, results in undefined behavior.
+     *
+     * @sa each
+     * @sa is_executor
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param exec A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    std::enable_if_t<is_executor_v<Executor>> each(Executor &&exec, Func func) const {
+        if(auto *view = storage(); view) {
+            constexpr std::size_t page = (Get::traits_type::page_size == 0u) ? ENTT_PACKED_PAGE : Get::traits_type::page_size;
+            const auto length = (view->policy() == deletion_policy::swap_only) ? view->free_list() : view->size();
+            [[maybe_unused]] const auto len = view->size();
+
+            internal::for_each_page(exec, view->disabled(), length, page, [view, &func](const std::size_t from, const std::size_t to) {
+                if constexpr(is_applicable_v<Func, decltype(*view->each().begin())>) {
+                    const auto range = view->each();
+
+                    for(auto first = range.end() - static_cast<std::ptrdiff_t>(to), last = range.end() - static_cast<std::ptrdiff_t>(from); first != last; ++first) {
+                        std::apply(func, *first);
+                    }
+                } else if constexpr(Get::traits_type::page_size == 0u) {
+                    for(auto pos = from; pos < to; ++pos) {
+                        func();
+                    }
+                } else {
+                    for(auto first = view->end() - static_cast<std::ptrdiff_t>(to), last = view->end() - static_cast<std::ptrdiff_t>(from); first != last; ++first) {
+                        func(*first);
+                    }
+                }
+            });
+
+            ENTT_ASSERT(len == view->size(), "Structural changes are not allowed");
+        }
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ a view.
      *
@@ -853,7 +1320,12 @@ public:
      * @return An iterable object to use to _visit_ the view.
      */
     [[nodiscard]] iterable each() const noexcept {
-        return storage() ? storage()->each() : iterable{};
+        if(auto *view = storage(); view) {
+            const auto range = view->each();
+            return iterable{range.begin(), range.end() - static_cast<std::ptrdiff_t>(view->disabled())};
+        }
+
+        return iterable{};
     }
 
     /**
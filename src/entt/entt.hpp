@@ -15,18 +15,22 @@
 #include "core/iterator.hpp"
 #include "core/memory.hpp"
 #include "core/monostate.hpp"
+#include "core/page_pool.hpp"
 #include "core/tuple.hpp"
 #include "core/type_info.hpp"
 #include "core/type_traits.hpp"
 #include "core/utility.hpp"
+#include "entity/command_buffer.hpp"
 #include "entity/component.hpp"
 #include "entity/entity.hpp"
 #include "entity/group.hpp"
 #include "entity/handle.hpp"
 #include "entity/helper.hpp"
+#include "entity/job_system.hpp"
 #include "entity/mixin.hpp"
 #include "entity/observer.hpp"
 #include "entity/organizer.hpp"
+#include "entity/owning_view.hpp"
 #include "entity/registry.hpp"
 #include "entity/runtime_view.hpp"
 #include "entity/snapshot.hpp"
@@ -34,8 +38,10 @@
 #include "entity/storage.hpp"
 #include "entity/view.hpp"
 #include "graph/adjacency_matrix.hpp"
+#include "graph/compressed_graph.hpp"
 #include "graph/dot.hpp"
 #include "graph/flow.hpp"
+#include "graph/schedule.hpp"
 #include "locator/locator.hpp"
 #include "meta/adl_pointer.hpp"
 #include "meta/container.hpp"
@@ -0,0 +1,392 @@
+#ifndef ENTT_GRAPH_COMPRESSED_GRAPH_HPP
+#define ENTT_GRAPH_COMPRESSED_GRAPH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/iterator.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+namespace internal {
+
+template<typename It>
+class compressed_edge_iterator {
+    using size_type = std::size_t;
+
+public:
+    using value_type = std::pair<size_type, size_type>;
+    using pointer = input_iterator_pointer<value_type>;
+    using reference = value_type;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+
+    constexpr compressed_edge_iterator() noexcept
+        : offset{},
+          it{},
+          vert{},
+          pos{},
+          last{},
+          reversed{} {}
+
+    constexpr compressed_edge_iterator(It from, It base, const size_type vertex, const size_type first, const size_type to, const bool in) noexcept
+        : offset{std::move(from)},
+          it{std::move(base)},
+          vert{vertex},
+          pos{first},
+          last{to},
+          reversed{in} {
+        for(; pos != last && offset[vert + 1u] <= pos; ++vert) {}
+    }
+
+    constexpr compressed_edge_iterator &operator++() noexcept {
+        for(++pos; pos != last && offset[vert + 1u] <= pos; ++vert) {}
+        return *this;
+    }
+
+    constexpr compressed_edge_iterator operator++(int) noexcept {
+        compressed_edge_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+        return *operator->();
+    }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept {
+        return reversed ? value_type{it[pos], vert} : value_type{vert, it[pos]};
+    }
+
+    template<typename Type>
+    friend constexpr bool operator==(const compressed_edge_iterator<Type> &, const compressed_edge_iterator<Type> &) noexcept;
+
+private:
+    It offset;
+    It it;
+    size_type vert;
+    size_type pos;
+    size_type last;
+    bool reversed;
+};
+
+template<typename Container>
+[[nodiscard]] inline constexpr bool operator==(const compressed_edge_iterator<Container> &lhs, const compressed_edge_iterator<Container> &rhs) noexcept {
+    return lhs.pos == rhs.pos;
+}
+
+template<typename Container>
+[[nodiscard]] inline constexpr bool operator!=(const compressed_edge_iterator<Container> &lhs, const compressed_edge_iterator<Container> &rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+} // namespace internal
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+/**
+ * @brief Basic implementation of a directed graph in compressed sparse row
+ * format.
+ *
+ * Both the out edges and the in edges of the vertices are stored in contiguous
+ * arrays. The memory usage is linear in the number of vertices and edges and
+ * visiting the edges of a vertex costs as much as the number of edges.<br/>
+ * Compressed graphs are immutable, they are meant to be built once from a set
+ * of edges and then visited as many times as needed.
+ *
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Allocator>
+class compressed_graph {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, std::size_t>, "Invalid value type");
+    using container_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Vertex type. */
+    using vertex_type = size_type;
+    /*! @brief Edge type. */
+    using edge_type = std::pair<vertex_type, vertex_type>;
+    /*! @brief Vertex iterator type. */
+    using vertex_iterator = iota_iterator<vertex_type>;
+    /*! @brief Edge iterator type. */
+    using edge_iterator = internal::compressed_edge_iterator<typename container_type::const_iterator>;
+    /*! @brief Out edge iterator type. */
+    using out_edge_iterator = edge_iterator;
+    /*! @brief In edge iterator type. */
+    using in_edge_iterator = edge_iterator;
+    /*! @brief Graph category tag. */
+    using graph_category = directed_tag;
+
+    /*! @brief Default constructor. */
+    compressed_graph() noexcept(noexcept(allocator_type{}))
+        : compressed_graph{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit compressed_graph(const allocator_type &allocator) noexcept
+        : out_offset{allocator},
+          out_vertex{allocator},
+          in_offset{allocator},
+          in_vertex{allocator} {}
+
+    /**
+     * @brief Constructs a container from a range of edges.
+     *
+     * Edges can be provided in any order. Duplicates are discarded.
+     *
+     * @tparam It Type of input iterator.
+     * @param vertices Number of vertices.
+     * @param first An iterator to the first element of the range of edges.
+     * @param last An iterator past the last element of the range of edges.
+     * @param allocator The allocator to use.
+     */
+    template<typename It>
+    compressed_graph(const size_type vertices, It first, It last, const allocator_type &allocator = allocator_type{})
+        : out_offset(vertices + 1u, 0u, allocator),
+          out_vertex{allocator},
+          in_offset(vertices + 1u, 0u, allocator),
+          in_vertex{allocator} {
+        std::vector<edge_type, typename alloc_traits::template rebind_alloc<edge_type>> edge{first, last, allocator};
+
+        if(!std::is_sorted(edge.cbegin(), edge.cend())) {
+            std::sort(edge.begin(), edge.end());
+        }
+
+        edge.erase(std::unique(edge.begin(), edge.end()), edge.end());
+        out_vertex.resize(edge.size());
+        in_vertex.resize(edge.size());
+
+        for(auto [lhs, rhs]: edge) {
+            ENTT_ASSERT(lhs < vertices && rhs < vertices, "Invalid vertex");
+            ++out_offset[lhs + 1u];
+            ++in_offset[rhs + 1u];
+        }
+
+        std::partial_sum(out_offset.cbegin(), out_offset.cend(), out_offset.begin());
+        std::partial_sum(in_offset.cbegin(), in_offset.cend(), in_offset.begin());
+        container_type next{in_offset.cbegin(), in_offset.cend() - 1u, allocator};
+
+        // edges are sorted by source, so are the in edges of each vertex
+        for(size_type pos{}, end = edge.size(); pos < end; ++pos) {
+            out_vertex[pos] = edge[pos].second;
+            in_vertex[next[edge[pos].second]++] = edge[pos].first;
+        }
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other The instance to copy from.
+     */
+    compressed_graph(const compressed_graph &other)
+        : compressed_graph{other, other.get_allocator()} {}
+
+    /**
+     * @brief Allocator-extended copy constructor.
+     * @param other The instance to copy from.
+     * @param allocator The allocator to use.
+     */
+    compressed_graph(const compressed_graph &other, const allocator_type &allocator)
+        : out_offset{other.out_offset, allocator},
+          out_vertex{other.out_vertex, allocator},
+          in_offset{other.in_offset, allocator},
+          in_vertex{other.in_vertex, allocator} {}
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    compressed_graph(compressed_graph &&other) noexcept
+        : compressed_graph{std::move(other), other.get_allocator()} {}
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    compressed_graph(compressed_graph &&other, const allocator_type &allocator)
+        : out_offset{std::move(other.out_offset), allocator},
+          out_vertex{std::move(other.out_vertex), allocator},
+          in_offset{std::move(other.in_offset), allocator},
+          in_vertex{std::move(other.in_vertex), allocator} {
+        other.clear();
+    }
+
+    /**
+     * @brief Default copy assignment operator.
+     * @param other The instance to copy from.
+     * @return This container.
+     */
+    compressed_graph &operator=(const compressed_graph &other) {
+        out_offset = other.out_offset;
+        out_vertex = other.out_vertex;
+        in_offset = other.in_offset;
+        in_vertex = other.in_vertex;
+        return *this;
+    }
+
+    /**
+     * @brief Default move assignment operator.
+     * @param other The instance to move from.
+     * @return This container.
+     */
+    compressed_graph &operator=(compressed_graph &&other) noexcept {
+        out_offset = std::move(other.out_offset);
+        out_vertex = std::move(other.out_vertex);
+        in_offset = std::move(other.in_offset);
+        in_vertex = std::move(other.in_vertex);
+        other.clear();
+        return *this;
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return out_offset.get_allocator();
+    }
+
+    /*! @brief Clears the compressed graph. */
+    void clear() noexcept {
+        out_offset.clear();
+        out_vertex.clear();
+        in_offset.clear();
+        in_vertex.clear();
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given compressed graph.
+     * @param other Compressed graph to exchange the content with.
+     */
+    void swap(compressed_graph &other) {
+        using std::swap;
+        swap(out_offset, other.out_offset);
+        swap(out_vertex, other.out_vertex);
+        swap(in_offset, other.in_offset);
+        swap(in_vertex, other.in_vertex);
+    }
+
+    /**
+     * @brief Returns the number of vertices.
+     * @return The number of vertices.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return out_offset.empty() ? 0u : (out_offset.size() - 1u);
+    }
+
+    /**
+     * @brief Returns the number of edges.
+     * @return The number of edges.
+     */
+    [[nodiscard]] size_type edge_count() const noexcept {
+        return out_vertex.size();
+    }
+
+    /**
+     * @brief Returns an iterable object to visit all vertices of a graph.
+     * @return An iterable object to visit all vertices of a graph.
+     */
+    [[nodiscard]] iterable_adaptor<vertex_iterator> vertices() const noexcept {
+        return {0u, size()};
+    }
+
+    /**
+     * @brief Returns an iterable object to visit all edges of a graph.
+     * @return An iterable object to visit all edges of a graph.
+     */
+    [[nodiscard]] iterable_adaptor<edge_iterator> edges() const noexcept {
+        const auto sz = out_vertex.size();
+        return {{out_offset.cbegin(), out_vertex.cbegin(), 0u, 0u, sz, false}, {out_offset.cbegin(), out_vertex.cbegin(), 0u, sz, sz, false}};
+    }
+
+    /**
+     * @brief Returns an iterable object to visit all out edges of a vertex.
+     * @param vertex The vertex of which to return all out edges.
+     * @return An iterable object to visit all out edges of a vertex.
+     */
+    [[nodiscard]] iterable_adaptor<out_edge_iterator> out_edges(const vertex_type vertex) const noexcept {
+        ENTT_ASSERT(vertex < size(), "Invalid vertex");
+        const auto from = out_offset[vertex];
+        const auto to = out_offset[vertex + 1u];
+        return {{out_offset.cbegin(), out_vertex.cbegin(), vertex, from, to, false}, {out_offset.cbegin(), out_vertex.cbegin(), vertex, to, to, false}};
+    }
+
+    /**
+     * @brief Returns an iterable object to visit all in edges of a vertex.
+     * @param vertex The vertex of which to return all in edges.
+     * @return An iterable object to visit all in edges of a vertex.
+     */
+    [[nodiscard]] iterable_adaptor<in_edge_iterator> in_edges(const vertex_type vertex) const noexcept {
+        ENTT_ASSERT(vertex < size(), "Invalid vertex");
+        const auto from = in_offset[vertex];
+        const auto to = in_offset[vertex + 1u];
+        return {{in_offset.cbegin(), in_vertex.cbegin(), vertex, from, to, true}, {in_offset.cbegin(), in_vertex.cbegin(), vertex, to, to, true}};
+    }
+
+    /**
+     * @brief Returns the number of out edges of a vertex.
+     * @param vertex A valid vertex.
+     * @return The number of out edges of the vertex.
+     */
+    [[nodiscard]] size_type out_degree(const vertex_type vertex) const noexcept {
+        ENTT_ASSERT(vertex < size(), "Invalid vertex");
+        return out_offset[vertex + 1u] - out_offset[vertex];
+    }
+
+    /**
+     * @brief Returns the number of in edges of a vertex.
+     * @param vertex A valid vertex.
+     * @return The number of in edges of the vertex.
+     */
+    [[nodiscard]] size_type in_degree(const vertex_type vertex) const noexcept {
+        ENTT_ASSERT(vertex < size(), "Invalid vertex");
+        return in_offset[vertex + 1u] - in_offset[vertex];
+    }
+
+    /**
+     * @brief Checks if a compressed graph contains a given edge.
+     * @param lhs The left hand vertex of the edge.
+     * @param rhs The right hand vertex of the edge.
+     * @return True if there is such an edge, false otherwise.
+     */
+    [[nodiscard]] bool contains(const vertex_type lhs, const vertex_type rhs) const {
+        if(lhs < size()) {
+            const auto first = out_vertex.cbegin() + static_cast<typename container_type::difference_type>(out_offset[lhs]);
+            const auto last = out_vertex.cbegin() + static_cast<typename container_type::difference_type>(out_offset[lhs + 1u]);
+            return std::binary_search(first, last, rhs);
+        }
+
+        return false;
+    }
+
+private:
+    container_type out_offset;
+    container_type out_vertex;
+    container_type in_offset;
+    container_type in_vertex;
+};
+
+} // namespace entt
+
+#endif
@@ -5,6 +5,7 @@
 #include <cstddef>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -16,7 +17,7 @@
 #include "../core/fwd.hpp"
 #include "../core/iterator.hpp"
 #include "../core/utility.hpp"
-#include "adjacency_matrix.hpp"
+#include "compressed_graph.hpp"
 #include "fwd.hpp"
 
 namespace entt {
@@ -32,7 +33,18 @@ class basic_flow {
     using task_container_type = dense_set<id_type, identity, std::equal_to<id_type>, typename alloc_traits::template rebind_alloc<id_type>>;
     using ro_rw_container_type = std::vector<std::pair<std::size_t, bool>, typename alloc_traits::template rebind_alloc<std::pair<std::size_t, bool>>>;
     using deps_container_type = dense_map<id_type, ro_rw_container_type, identity, std::equal_to<id_type>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, ro_rw_container_type>>>;
-    using adjacency_matrix_type = adjacency_matrix<directed_tag, typename alloc_traits::template rebind_alloc<std::size_t>>;
+    using compressed_graph_type = compressed_graph<typename alloc_traits::template rebind_alloc<std::size_t>>;
+    using bitset_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
+
+    static constexpr auto digits = std::numeric_limits<std::size_t>::digits;
+
+    [[nodiscard]] static bool contains(const bitset_type &bits, const std::size_t words, const std::size_t lhs, const std::size_t rhs) noexcept {
+        return (bits[lhs * words + rhs / digits] >> (rhs % digits)) & 1u;
+    }
+
+    static void insert(bitset_type &bits, const std::size_t words, const std::size_t lhs, const std::size_t rhs) noexcept {
+        bits[lhs * words + rhs / digits] |= (std::size_t{1u} << (rhs % digits));
+    }
 
     void emplace(const id_type res, const bool is_rw) {
         ENTT_ASSERT(index.first() < vertices.size(), "Invalid node");
@@ -44,7 +56,7 @@ class basic_flow {
         deps[res].emplace_back(index.first(), is_rw);
     }
 
-    void setup_graph(adjacency_matrix_type &matrix) const {
+    void setup_graph(bitset_type &bits, const std::size_t words) const {
         for(const auto &elem: deps) {
             const auto last = elem.second.cend();
             auto it = elem.second.cbegin();
@@ -54,15 +66,15 @@ class basic_flow {
                     // rw item
                     if(auto curr = it++; it != last) {
                         if(it->second) {
-                            matrix.insert(curr->first, it->first);
+                            insert(bits, words, curr->first, it->first);
                         } else if(const auto next = std::find_if(it, last, [](const auto &value) { return value.second; }); next != last) {
                             for(; it != next; ++it) {
-                                matrix.insert(curr->first, it->first);
-                                matrix.insert(it->first, next->first);
+                                insert(bits, words, curr->first, it->first);
+                                insert(bits, words, it->first, next->first);
                             }
                         } else {
                             for(; it != next; ++it) {
-                                matrix.insert(curr->first, it->first);
+                                insert(bits, words, curr->first, it->first);
                             }
                         }
                     }
@@ -70,7 +82,7 @@ class basic_flow {
                     // ro item (first iteration only)
                     if(const auto next = std::find_if(it, last, [](const auto &value) { return value.second; }); next != last) {
                         for(; it != next; ++it) {
-                            matrix.insert(it->first, next->first);
+                            insert(bits, words, it->first, next->first);
                         }
                     } else {
                         it = last;
@@ -80,34 +92,32 @@ class basic_flow {
         }
     }
 
-    void transitive_closure(adjacency_matrix_type &matrix) const {
-        const auto length = matrix.size();
+    void transitive_closure(bitset_type &bits, const std::size_t words) const {
+        const auto length = vertices.size();
 
         for(std::size_t vk{}; vk < length; ++vk) {
             for(std::size_t vi{}; vi < length; ++vi) {
-                for(std::size_t vj{}; vj < length; ++vj) {
-                    if(matrix.contains(vi, vk) && matrix.contains(vk, vj)) {
-                        matrix.insert(vi, vj);
+                if(contains(bits, words, vi, vk)) {
+                    for(std::size_t word{}; word < words; ++word) {
+                        bits[vi * words + word] |= bits[vk * words + word];
                     }
                 }
             }
         }
     }
 
-    void transitive_reduction(adjacency_matrix_type &matrix) const {
-        const auto length = matrix.size();
+    void transitive_reduction(bitset_type &bits, const std::size_t words) const {
+        const auto length = vertices.size();
 
         for(std::size_t vert{}; vert < length; ++vert) {
-            matrix.erase(vert, vert);
+            bits[vert * words + vert / digits] &= ~(std::size_t{1u} << (vert % digits));
         }
 
         for(std::size_t vj{}; vj < length; ++vj) {
             for(std::size_t vi{}; vi < length; ++vi) {
-                if(matrix.contains(vi, vj)) {
-                    for(std::size_t vk{}; vk < length; ++vk) {
-                        if(matrix.contains(vj, vk)) {
-                            matrix.erase(vi, vk);
-                        }
+                if(contains(bits, words, vi, vj)) {
+                    for(std::size_t word{}; word < words; ++word) {
+                        bits[vi * words + word] &= ~bits[vj * words + word];
                     }
                 }
             }
@@ -121,8 +131,8 @@ public:
     using size_type = std::size_t;
     /*! @brief Iterable task list. */
     using iterable = iterable_adaptor<typename task_container_type::const_iterator>;
-    /*! @brief Adjacency matrix type. */
-    using graph_type = adjacency_matrix_type;
+    /*! @brief Compressed graph type. */
+    using graph_type = compressed_graph_type;
 
     /*! @brief Default constructor. */
     basic_flow()
@@ -317,16 +327,29 @@ public:
 
     /**
      * @brief Generates a task graph for the current content.
-     * @return The adjacency matrix of the task graph.
+     * @return The compressed graph of the task graph.
      */
     [[nodiscard]] graph_type graph() const {
-        graph_type matrix{vertices.size(), get_allocator()};
+        const auto length = vertices.size();
+        const auto words = (length + digits - 1u) / digits;
+        bitset_type bits(length * words, 0u, get_allocator());
 
-        setup_graph(matrix);
-        transitive_closure(matrix);
-        transitive_reduction(matrix);
+        // rows of bits make closure and reduction a matter of word-wise operations
+        setup_graph(bits, words);
+        transitive_closure(bits, words);
+        transitive_reduction(bits, words);
+
+        std::vector<typename graph_type::edge_type, typename alloc_traits::template rebind_alloc<typename graph_type::edge_type>> edges{get_allocator()};
+
+        for(std::size_t vi{}; vi < length; ++vi) {
+            for(std::size_t vj{}; vj < length; ++vj) {
+                if(contains(bits, words, vi, vj)) {
+                    edges.emplace_back(vi, vj);
+                }
+            }
+        }
 
-        return matrix;
+        return graph_type{length, edges.cbegin(), edges.cend(), get_allocator()};
     }
 
 private:
@@ -16,12 +16,21 @@ struct undirected_tag: directed_tag {};
 template<typename, typename = std::allocator<std::size_t>>
 class adjacency_matrix;
 
+template<typename = std::allocator<std::size_t>>
+class compressed_graph;
+
 template<typename = std::allocator<id_type>>
 class basic_flow;
 
+template<typename = std::allocator<std::size_t>>
+class basic_schedule;
+
 /*! @brief Alias declaration for the most common use case. */
 using flow = basic_flow<>;
 
+/*! @brief Alias declaration for the most common use case. */
+using schedule = basic_schedule<>;
+
 } // namespace entt
 
 #endif
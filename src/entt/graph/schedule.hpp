@@ -0,0 +1,225 @@
+#ifndef ENTT_GRAPH_SCHEDULE_HPP
+#define ENTT_GRAPH_SCHEDULE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Cost-aware schedule of a directed acyclic graph.
+ *
+ * Given the cost of each vertex, a schedule offers the earliest start of the
+ * vertices, their priority (that is, the length of the longest path from a
+ * vertex to the end of the graph, the vertex itself included), the critical
+ * path of the graph and an order of execution that launches the vertices with
+ * the highest priority first.
+ *
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Allocator>
+class basic_schedule {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, std::size_t>, "Invalid value type");
+    using container_type = std::vector<std::size_t, Allocator>;
+    using cost_container_type = std::vector<double, typename alloc_traits::template rebind_alloc<double>>;
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Vertex type. */
+    using vertex_type = std::size_t;
+    /*! @brief Cost type. */
+    using cost_type = double;
+
+    /*! @brief Default constructor. */
+    basic_schedule()
+        : basic_schedule{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty schedule with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_schedule(const allocator_type &allocator)
+        : start{allocator},
+          rank{allocator},
+          sequence{allocator},
+          path{allocator} {}
+
+    /**
+     * @brief Constructs a schedule for a given graph.
+     * @tparam Graph Graph type, valid as long as it exposes edges and vertices.
+     * @tparam Func Type of function object to use to get the cost of vertices.
+     * @param graph A directed acyclic graph.
+     * @param cost A valid function object that returns the cost of a vertex.
+     * @param allocator The allocator to use.
+     */
+    template<typename Graph, typename Func>
+    basic_schedule(const Graph &graph, Func cost, const allocator_type &allocator = allocator_type{})
+        : basic_schedule{allocator} {
+        update(graph, std::move(cost));
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return sequence.get_allocator();
+    }
+
+    /**
+     * @brief Updates a schedule for a given graph.
+     *
+     * The signature of the function object should be equivalent to the
+     * following:
+     *
+     * @code{.cpp}
+     * double(const std::size_t);
+     * @endcode
+     *
+     * Costs are expected to be non-negative values.
+     *
+     * @tparam Graph Graph type, valid as long as it exposes edges and vertices.
+     * @tparam Func Type of function object to use to get the cost of vertices.
+     * @param graph A directed acyclic graph.
+     * @param cost A valid function object that returns the cost of a vertex.
+     */
+    template<typename Graph, typename Func>
+    void update(const Graph &graph, Func cost) {
+        static_assert(std::is_same_v<typename Graph::graph_category, directed_tag>, "Invalid graph category");
+        const auto length = graph.size();
+        cost_container_type weight(length, cost_type{}, start.get_allocator());
+        container_type degree(length, size_type{}, sequence.get_allocator());
+
+        for(auto [lhs, rhs]: graph.edges()) {
+            ++degree[rhs];
+        }
+
+        sequence.clear();
+
+        for(auto &&vertex: graph.vertices()) {
+            weight[vertex] = cost(vertex);
+
+            if(degree[vertex] == 0u) {
+                sequence.push_back(vertex);
+            }
+        }
+
+        // topological order first, then earliest start and priority of vertices
+        for(size_type pos{}; pos < sequence.size(); ++pos) {
+            for(auto [lhs, rhs]: graph.out_edges(sequence[pos])) {
+                if(--degree[rhs] == 0u) {
+                    sequence.push_back(rhs);
+                }
+            }
+        }
+
+        ENTT_ASSERT(sequence.size() == length, "Cyclic graph");
+        start.assign(length, cost_type{});
+        rank.assign(length, cost_type{});
+
+        for(auto vertex: sequence) {
+            for(auto [lhs, rhs]: graph.out_edges(vertex)) {
+                start[rhs] = (std::max)(start[rhs], start[vertex] + weight[vertex]);
+            }
+        }
+
+        for(auto it = sequence.rbegin(), last = sequence.rend(); it != last; ++it) {
+            for(auto [lhs, rhs]: graph.out_edges(*it)) {
+                rank[*it] = (std::max)(rank[*it], rank[rhs]);
+            }
+
+            rank[*it] += weight[*it];
+        }
+
+        // ties preserve the topological order, so that the result is still a valid one
+        std::stable_sort(sequence.begin(), sequence.end(), [this](const auto lhs, const auto rhs) { return rank[lhs] > rank[rhs]; });
+        path.clear();
+
+        if(!sequence.empty()) {
+            // the vertex with the highest priority is always a source
+            for(auto next = sequence.front(), curr = next + 1u; next != curr;) {
+                curr = next;
+                path.push_back(curr);
+
+                for(auto [lhs, rhs]: graph.out_edges(curr)) {
+                    if(next == curr || rank[rhs] > rank[next]) {
+                        next = rhs;
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of vertices of a schedule.
+     * @return The number of vertices.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return sequence.size();
+    }
+
+    /**
+     * @brief Returns the earliest start of a vertex.
+     * @param vertex A valid vertex.
+     * @return The sum of the costs along the longest path to the vertex.
+     */
+    [[nodiscard]] cost_type earliest_start(const vertex_type vertex) const {
+        ENTT_ASSERT(vertex < start.size(), "Invalid vertex");
+        return start[vertex];
+    }
+
+    /**
+     * @brief Returns the priority of a vertex.
+     * @param vertex A valid vertex.
+     * @return The sum of the costs along the longest path from the vertex to
+     * the end of the graph, the vertex itself included.
+     */
+    [[nodiscard]] cost_type priority(const vertex_type vertex) const {
+        ENTT_ASSERT(vertex < rank.size(), "Invalid vertex");
+        return rank[vertex];
+    }
+
+    /**
+     * @brief Returns the length of a schedule.
+     * @return The sum of the costs along the critical path.
+     */
+    [[nodiscard]] cost_type makespan() const noexcept {
+        return sequence.empty() ? cost_type{} : rank[sequence.front()];
+    }
+
+    /**
+     * @brief Returns the vertices in order of priority.
+     * @return A topological order of the vertices, highest priority first.
+     */
+    [[nodiscard]] const container_type &order() const noexcept {
+        return sequence;
+    }
+
+    /**
+     * @brief Returns the critical path of a graph.
+     * @return The vertices along the longest path of the graph.
+     */
+    [[nodiscard]] const container_type &critical_path() const noexcept {
+        return path;
+    }
+
+private:
+    cost_container_type start;
+    cost_container_type rank;
+    container_type sequence;
+    container_type path;
+};
+
+} // namespace entt
+
+#endif
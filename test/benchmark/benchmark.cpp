@@ -1,4 +1,5 @@
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <utility>
@@ -6,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/runtime_view.hpp>
+#include "../entt/common/thread_executor.hpp"
 
 struct position {
     std::uint64_t x;
@@ -23,6 +25,23 @@ struct comp {
     int x;
 };
 
+enum class indexed_entity : std::uint32_t {};
+
+struct indexed_entity_traits {
+    using value_type = indexed_entity;
+    using entity_type = std::uint32_t;
+    using version_type = std::uint16_t;
+    static constexpr entity_type entity_mask = 0xFFFFF;
+    static constexpr entity_type version_mask = 0xFFF;
+};
+
+template<>
+struct entt::entt_traits<indexed_entity>: entt::basic_entt_traits<indexed_entity_traits> {
+    using base_type = entt::basic_entt_traits<indexed_entity_traits>;
+    static constexpr std::size_t page_size = ENTT_SPARSE_PAGE;
+    static constexpr bool presence_index = true;
+};
+
 struct timer final {
     timer()
         : start{std::chrono::system_clock::now()} {}
@@ -553,6 +572,27 @@ TEST(Benchmark, IterateTwoComponents1MOne) {
     });
 }
 
+TEST(Benchmark, IterateTwoComponents1MShuffled) {
+    entt::registry registry;
+
+    std::cout << "Iterating over 1000000 entities, two components, shuffled leading storage (prefetch distance " << ENTT_VIEW_PREFETCH << ")" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entt = registry.create();
+        registry.emplace<position>(entt);
+        registry.emplace<velocity>(entt);
+    }
+
+    // lookups in the other storage hit the sparse array and the payload at random
+    registry.sort<position>([](const entt::entity lhs, const entt::entity rhs) {
+        return (entt::to_integral(lhs) * 2654435761u) < (entt::to_integral(rhs) * 2654435761u);
+    });
+
+    iterate_with(registry.view<position, velocity>(), [](auto &...comp) {
+        ((comp.x = {}), ...);
+    });
+}
+
 TEST(Benchmark, IterateTwoComponentsNonOwningGroup1M) {
     entt::registry registry;
 
@@ -744,6 +784,28 @@ TEST(Benchmark, IterateThreeComponents1MOne) {
     });
 }
 
+TEST(Benchmark, IterateThreeComponents1MShuffled) {
+    entt::registry registry;
+
+    std::cout << "Iterating over 1000000 entities, three components, shuffled leading storage (prefetch distance " << ENTT_VIEW_PREFETCH << ")" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entt = registry.create();
+        registry.emplace<position>(entt);
+        registry.emplace<velocity>(entt);
+        registry.emplace<comp<0>>(entt);
+    }
+
+    // lookups in the other storage hit the sparse array and the payload at random
+    registry.sort<position>([](const entt::entity lhs, const entt::entity rhs) {
+        return (entt::to_integral(lhs) * 2654435761u) < (entt::to_integral(rhs) * 2654435761u);
+    });
+
+    iterate_with(registry.view<position, velocity, comp<0>>(), [](auto &...comp) {
+        ((comp.x = {}), ...);
+    });
+}
+
 TEST(Benchmark, IterateThreeComponentsNonOwningGroup1M) {
     entt::registry registry;
 
@@ -955,6 +1017,50 @@ TEST(Benchmark, IterateFiveComponents1MOne) {
     });
 }
 
+TEST(Benchmark, IterateFiveComponents1MLowHit) {
+    entt::registry registry;
+
+    std::cout << "Iterating over 1000000 entities, five components, few entities have all the components" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entt = registry.create();
+        registry.emplace<position>(entt);
+        (i % 2) ? void() : void(registry.emplace<velocity>(entt));
+        (i % 3) ? void() : void(registry.emplace<comp<0>>(entt));
+        (i % 5) ? void() : void(registry.emplace<comp<1>>(entt));
+        (i % 7) ? void() : void(registry.emplace<comp<2>>(entt));
+    }
+
+    iterate_with(registry.view<position, velocity, comp<0>, comp<1>, comp<2>>(), [](auto &...comp) {
+        ((comp.x = {}), ...);
+    });
+}
+
+TEST(Benchmark, IterateFiveComponents1MLowHitPresenceIndex) {
+    entt::basic_registry<indexed_entity> registry;
+
+    std::cout << "Iterating over 1000000 entities, five components, few entities have all the components, presence index" << std::endl;
+
+    registry.storage<position>().presence_index(true);
+    registry.storage<velocity>().presence_index(true);
+    registry.storage<comp<0>>().presence_index(true);
+    registry.storage<comp<1>>().presence_index(true);
+    registry.storage<comp<2>>().presence_index(true);
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entt = registry.create();
+        registry.emplace<position>(entt);
+        (i % 2) ? void() : void(registry.emplace<velocity>(entt));
+        (i % 3) ? void() : void(registry.emplace<comp<0>>(entt));
+        (i % 5) ? void() : void(registry.emplace<comp<1>>(entt));
+        (i % 7) ? void() : void(registry.emplace<comp<2>>(entt));
+    }
+
+    iterate_with(registry.view<position, velocity, comp<0>, comp<1>, comp<2>>(), [](auto &...comp) {
+        ((comp.x = {}), ...);
+    });
+}
+
 TEST(Benchmark, IterateFiveComponentsNonOwningGroup1M) {
     entt::registry registry;
 
@@ -1162,6 +1268,21 @@ TEST(Benchmark, SortSingle) {
     });
 }
 
+TEST(Benchmark, SortSingleParallel) {
+    entt::registry registry;
+
+    std::cout << "Sort 150000 entities, one component, parallel" << std::endl;
+
+    for(std::uint64_t i = 0; i < 150000L; i++) {
+        const auto entt = registry.create();
+        registry.emplace<position>(entt, i, i);
+    }
+
+    generic_with([&]() {
+        registry.sort<position>(test::thread_executor{}, [](const auto &lhs, const auto &rhs) { return lhs.x < rhs.x && lhs.y < rhs.y; });
+    });
+}
+
 TEST(Benchmark, SortMulti) {
     entt::registry registry;
 
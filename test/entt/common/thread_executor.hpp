@@ -0,0 +1,33 @@
+#ifndef ENTT_COMMON_THREAD_EXECUTOR_HPP
+#define ENTT_COMMON_THREAD_EXECUTOR_HPP
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace test {
+
+struct thread_executor {
+    template<typename Func>
+    void operator()(const std::size_t first, const std::size_t last, Func task) const {
+        std::vector<std::thread> workers{};
+
+        for(std::size_t next{}; next < size; ++next) {
+            workers.emplace_back([&task, first, last, next, step = size]() {
+                for(auto pos = first + next; pos < last; pos += step) {
+                    task(pos);
+                }
+            });
+        }
+
+        for(auto &&elem: workers) {
+            elem.join();
+        }
+    }
+
+    std::size_t size{4u};
+};
+
+} // namespace test
+
+#endif
@@ -1,12 +1,37 @@
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
 #include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/algorithm.hpp>
+#include "../common/thread_executor.hpp"
 
 struct boxed_int {
     int value;
 };
 
+struct counted_int {
+    counted_int() = default;
+
+    counted_int(unsigned int elem)
+        : value{elem} {}
+
+    counted_int(counted_int &&other) noexcept
+        : value{other.value} {}
+
+    counted_int &operator=(counted_int &&other) noexcept {
+        value = other.value;
+        ++moves;
+        return *this;
+    }
+
+    static inline std::size_t moves{};
+    unsigned int value{};
+};
+
 TEST(Algorithm, StdSort) {
     // well, I'm pretty sure it works, it's std::sort!!
     std::array<int, 5> arr{{4, 1, 3, 2, 0}};
@@ -64,6 +89,51 @@ TEST(Algorithm, InsertionSortEmptyContainer) {
     sort(vec.begin(), vec.end());
 }
 
+TEST(Algorithm, IsExecutor) {
+    ASSERT_TRUE(entt::is_executor_v<test::thread_executor>);
+    ASSERT_TRUE((entt::is_executor_v<void (*)(std::size_t, std::size_t, std::function<void(std::size_t)>)>));
+    ASSERT_FALSE(entt::is_executor_v<std::less<>>);
+    ASSERT_FALSE(entt::is_executor_v<bool (*)(int, int)>);
+    ASSERT_FALSE(entt::is_executor_v<int>);
+
+    auto variadic = [](auto...) { return true; };
+
+    ASSERT_FALSE(entt::is_executor_v<decltype(variadic)>);
+}
+
+TEST(Algorithm, ParallelSort) {
+    std::vector<int> vec(20000u);
+    entt::parallel_sort sort;
+
+    for(std::size_t pos{}; pos < vec.size(); ++pos) {
+        vec[pos] = static_cast<int>((pos * 7919u) % vec.size());
+    }
+
+    sort(vec.begin(), vec.end(), std::less{}, test::thread_executor{});
+
+    for(auto i = 0u; i < (vec.size() - 1u); ++i) {
+        ASSERT_LT(vec[i], vec[i + 1u]);
+    }
+}
+
+TEST(Algorithm, ParallelSortBoxedInt) {
+    std::array<boxed_int, 6> arr{{{4}, {1}, {3}, {2}, {0}, {6}}};
+    entt::parallel_sort sort;
+
+    sort(arr.begin(), arr.end(), [](const auto &lhs, const auto &rhs) { return lhs.value > rhs.value; }, test::thread_executor{});
+
+    for(auto i = 0u; i < (arr.size() - 1u); ++i) {
+        ASSERT_GT(arr[i].value, arr[i + 1u].value);
+    }
+}
+
+TEST(Algorithm, ParallelSortEmptyContainer) {
+    std::vector<int> vec{};
+    entt::parallel_sort sort;
+    // this should crash with asan enabled if we break the constraint
+    sort(vec.begin(), vec.end(), std::less{}, test::thread_executor{});
+}
+
 TEST(Algorithm, RadixSort) {
     std::array<uint32_t, 5> arr{{4, 1, 3, 2, 0}};
     entt::radix_sort<8, 32> sort;
@@ -96,3 +166,74 @@ TEST(Algorithm, RadixSortEmptyContainer) {
     // this should crash with asan enabled if we break the constraint
     sort(vec.begin(), vec.end());
 }
+
+TEST(Algorithm, RadixSortSkipPasses) {
+    std::vector<counted_int> vec{};
+    entt::radix_sort<8, 32> sort;
+
+    for(auto elem: {4u, 1u, 255u, 3u, 2u, 0u}) {
+        vec.emplace_back(elem | 0xAB0000u);
+    }
+
+    counted_int::moves = 0u;
+
+    sort(vec.begin(), vec.end(), [](const auto &instance) {
+        return instance.value;
+    });
+
+    // one pass forth and back, others are skipped
+    ASSERT_EQ(counted_int::moves, 2u * vec.size());
+
+    for(auto i = 0u; i < (vec.size() - 1u); ++i) {
+        ASSERT_LT(vec[i].value, vec[i + 1u].value);
+    }
+}
+
+TEST(Algorithm, RadixSortScratchBuffer) {
+    std::array<unsigned int, 6> arr{{0x400u, 1u, 0x30000u, 2u, 0u, 0x6000000u}};
+    std::array<unsigned int, 6> scratch{};
+    entt::radix_sort<8, 32> sort;
+
+    sort(arr.begin(), arr.end(), entt::identity{}, scratch.begin());
+
+    for(auto i = 0u; i < (arr.size() - 1u); ++i) {
+        ASSERT_LT(arr[i], arr[i + 1u]);
+    }
+
+    sort(arr.rbegin(), arr.rend(), entt::identity{}, std::allocator<unsigned int>{});
+
+    for(auto i = 0u; i < (arr.size() - 1u); ++i) {
+        ASSERT_GT(arr[i], arr[i + 1u]);
+    }
+}
+
+TEST(Algorithm, RadixSortParallel) {
+    std::vector<unsigned int> vec(50000u);
+    std::vector<unsigned int> scratch(vec.size());
+    entt::radix_sort<8, 32> sort;
+
+    for(std::size_t pos{}; pos < vec.size(); ++pos) {
+        vec[pos] = static_cast<unsigned int>((pos * 2654435761u) % 4294967291u);
+    }
+
+    auto expected = vec;
+    std::sort(expected.begin(), expected.end());
+
+    sort(vec.begin(), vec.end(), entt::identity{}, test::thread_executor{});
+
+    ASSERT_EQ(vec, expected);
+
+    std::reverse(vec.begin(), vec.end());
+    sort(vec.begin(), vec.end(), entt::identity{}, test::thread_executor{}, scratch.begin());
+
+    ASSERT_EQ(vec, expected);
+
+    for(auto &&elem: vec) {
+        elem &= 0xFF00u;
+    }
+
+    std::reverse(vec.begin(), vec.end());
+    sort(vec.begin(), vec.end(), entt::identity{}, test::thread_executor{}, std::allocator<unsigned int>{});
+
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+}
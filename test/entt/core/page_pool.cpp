@@ -0,0 +1,247 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/page_pool.hpp>
+#include <entt/entity/registry.hpp>
+
+struct alignas(64u) over_aligned {
+    std::uint64_t value;
+};
+
+TEST(PagePool, Functionalities) {
+    entt::page_pool pool{2u};
+
+    ASSERT_EQ(pool.high_water_mark(), 2u);
+    ASSERT_EQ(pool.size(), 0u);
+    ASSERT_EQ(pool.memory(), 0u);
+
+    void *first = pool.allocate(128u, alignof(std::max_align_t));
+    void *second = pool.allocate(128u, alignof(std::max_align_t));
+    void *third = pool.allocate(128u, alignof(std::max_align_t));
+
+    ASSERT_EQ(pool.misses(), 3u);
+    ASSERT_EQ(pool.hits(), 0u);
+
+    pool.deallocate(first, 128u, alignof(std::max_align_t));
+    pool.deallocate(second, 128u, alignof(std::max_align_t));
+    pool.deallocate(third, 128u, alignof(std::max_align_t));
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.memory(), 256u);
+    ASSERT_EQ(pool.released(), 1u);
+
+    ASSERT_EQ(pool.allocate(128u, alignof(std::max_align_t)), second);
+    ASSERT_EQ(pool.hits(), 1u);
+    ASSERT_EQ(pool.size(), 1u);
+
+    pool.deallocate(second, 128u, alignof(std::max_align_t));
+    pool.release();
+
+    ASSERT_EQ(pool.size(), 0u);
+}
+
+TEST(PagePool, HighWaterMark) {
+    entt::page_pool pool{};
+    std::vector<void *> blocks{};
+
+    pool.high_water_mark_of(32u, 1u);
+
+    ASSERT_EQ(pool.high_water_mark_of(32u), 1u);
+    ASSERT_EQ(pool.high_water_mark_of(64u), pool.high_water_mark());
+
+    for(std::size_t pos{}; pos < 4u; ++pos) {
+        blocks.push_back(pool.allocate(32u, alignof(void *)));
+        blocks.push_back(pool.allocate(64u, alignof(void *)));
+    }
+
+    for(std::size_t pos{}; pos < blocks.size(); ++pos) {
+        pool.deallocate(blocks[pos], (pos % 2u) ? 64u : 32u, alignof(void *));
+    }
+
+    ASSERT_EQ(pool.size(), 5u);
+
+    pool.high_water_mark(2u);
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.high_water_mark_of(32u), 1u);
+
+    pool.high_water_mark_of(32u, 0u);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.memory(), 128u);
+}
+
+TEST(PagePool, Budget) {
+    entt::page_pool pool{4u, 256u};
+
+    ASSERT_EQ(pool.budget(), 256u);
+
+    void *first = pool.allocate(128u, alignof(std::max_align_t));
+    void *second = pool.allocate(128u, alignof(std::max_align_t));
+    void *third = pool.allocate(128u, alignof(std::max_align_t));
+    void *large = pool.allocate(512u, alignof(std::max_align_t));
+
+    ASSERT_EQ(pool.misses(), 3u);
+
+    pool.deallocate(first, 128u, alignof(std::max_align_t));
+    pool.deallocate(second, 128u, alignof(std::max_align_t));
+    pool.deallocate(third, 128u, alignof(std::max_align_t));
+    pool.deallocate(large, 512u, alignof(std::max_align_t));
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.memory(), 256u);
+    ASSERT_EQ(pool.released(), 2u);
+
+    pool.budget(128u);
+
+    ASSERT_EQ(pool.budget(), 128u);
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_EQ(pool.memory(), 128u);
+    ASSERT_EQ(pool.released(), 3u);
+}
+
+TEST(PagePool, SizeClasses) {
+    entt::page_pool pool{};
+    std::vector<void *> blocks{};
+
+    for(std::size_t pos{}; pos <= entt::page_pool::max_size_classes; ++pos) {
+        blocks.push_back(pool.allocate((pos + 1u) * sizeof(void *), alignof(void *)));
+    }
+
+    ASSERT_EQ(pool.misses(), entt::page_pool::max_size_classes);
+
+    for(std::size_t pos{}; pos < blocks.size(); ++pos) {
+        pool.deallocate(blocks[pos], (pos + 1u) * sizeof(void *), alignof(void *));
+    }
+
+    ASSERT_EQ(pool.size(), entt::page_pool::max_size_classes);
+    ASSERT_EQ(pool.released(), 1u);
+}
+
+TEST(PagePool, Uncacheable) {
+    entt::page_pool pool{};
+
+    void *ptr = pool.allocate(1u, 1u);
+    pool.deallocate(ptr, 1u, 1u);
+
+    ASSERT_EQ(pool.size(), 0u);
+    ASSERT_EQ(pool.misses(), 0u);
+    ASSERT_EQ(pool.released(), 1u);
+}
+
+TEST(PageAllocator, Functionalities) {
+    entt::page_pool pool{};
+    entt::page_allocator<int> allocator{pool};
+    entt::page_allocator<over_aligned> other{allocator};
+
+    ASSERT_EQ(allocator, other);
+    ASSERT_NE(allocator, entt::page_allocator<int>{});
+    ASSERT_EQ(other.resource(), &pool);
+    ASSERT_EQ(entt::page_allocator<char>{}.resource(), nullptr);
+
+    auto *value = other.allocate(3u);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(value) % alignof(over_aligned), 0u);
+
+    other.deallocate(value, 3u);
+
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_EQ(other.allocate(3u), value);
+
+    other.deallocate(value, 3u);
+
+    entt::page_allocator<int> unbound{};
+    auto *elem = unbound.allocate(2u);
+    unbound.deallocate(elem, 2u);
+
+    ASSERT_EQ(pool.size(), 1u);
+}
+
+TEST(PageAllocator, SmallAlignment) {
+    entt::page_pool pool{};
+    entt::page_allocator<entt::entity> allocator{pool};
+    entt::page_allocator<int> other{allocator};
+
+    auto *entity = allocator.allocate(16u);
+    auto *value = other.allocate(16u);
+
+    allocator.deallocate(entity, 16u);
+    other.deallocate(value, 16u);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.released(), 0u);
+
+    ASSERT_EQ(allocator.allocate(16u), reinterpret_cast<entt::entity *>(value));
+    ASSERT_EQ(other.allocate(16u), reinterpret_cast<int *>(entity));
+    ASSERT_EQ(pool.hits(), 2u);
+
+    allocator.deallocate(reinterpret_cast<entt::entity *>(value), 16u);
+    other.deallocate(reinterpret_cast<int *>(entity), 16u);
+}
+
+TEST(PageAllocator, RegistryIntPages) {
+    using registry_type = entt::basic_registry<entt::entity, entt::page_allocator<entt::entity>>;
+    entt::page_pool pool{};
+
+    const auto populate = [](registry_type &registry) {
+        for(std::size_t pos{}; pos < 4096u; ++pos) {
+            registry.emplace<int>(registry.create(), static_cast<int>(pos));
+        }
+    };
+
+    {
+        registry_type registry{pool};
+        populate(registry);
+    }
+
+    const auto hits = pool.hits();
+    const auto misses = pool.misses();
+
+    // packed pages of ints alone are worth this much memory
+    ASSERT_GE(pool.memory(), 4096u * sizeof(int));
+
+    {
+        registry_type registry{pool};
+        populate(registry);
+
+        ASSERT_EQ(pool.misses(), misses);
+        ASSERT_GT(pool.hits(), hits);
+    }
+}
+
+TEST(PageAllocator, Registry) {
+    using registry_type = entt::basic_registry<entt::entity, entt::page_allocator<entt::entity>>;
+    entt::page_pool pool{};
+
+    const auto populate = [](registry_type &registry) {
+        for(std::size_t pos{}; pos < 4096u; ++pos) {
+            const auto entity = registry.create();
+            registry.emplace<int>(entity, static_cast<int>(pos));
+            registry.emplace<double>(entity);
+        }
+    };
+
+    {
+        registry_type registry{pool};
+        populate(registry);
+    }
+
+    const auto cached = pool.size();
+    const auto hits = pool.hits();
+    const auto misses = pool.misses();
+
+    ASSERT_NE(cached, 0u);
+
+    {
+        registry_type registry{pool};
+        populate(registry);
+
+        ASSERT_EQ(registry.storage<int>().get_allocator(), entt::page_allocator<int>{pool});
+        ASSERT_EQ(pool.misses(), misses);
+        ASSERT_GT(pool.hits(), hits);
+    }
+
+    ASSERT_EQ(pool.size(), cached);
+}
@@ -0,0 +1,144 @@
+#include <cstddef>
+#include <memory>
+#include <gtest/gtest.h>
+#include <entt/entity/command_buffer.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include "../common/thread_executor.hpp"
+
+struct empty_type {};
+
+struct aggregate_type {
+    int value;
+};
+
+TEST(CommandBuffer, Functionalities) {
+    entt::registry registry;
+    entt::command_buffer buffer{registry};
+
+    ASSERT_EQ(&buffer.registry(), &registry);
+    ASSERT_TRUE(buffer.empty());
+
+    const auto entity = registry.create();
+    const auto other = buffer.create();
+
+    ASSERT_NE(entity, other);
+    ASSERT_FALSE(registry.valid(other));
+    ASSERT_EQ(registry.storage<entt::entity>().reserved(), 1u);
+
+    buffer.emplace<int>(entity, 1);
+    buffer.emplace<int>(other, 2);
+    buffer.emplace<char>(entity, 'c');
+    buffer.emplace<empty_type>(other);
+    buffer.emplace<aggregate_type>(other, 3);
+
+    ASSERT_FALSE(buffer.empty());
+    ASSERT_FALSE(registry.any_of<int>(entity));
+    ASSERT_FALSE(registry.any_of<int>(other));
+
+    buffer.flush();
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_TRUE(registry.valid(other));
+    ASSERT_EQ(registry.storage<entt::entity>().reserved(), 0u);
+
+    ASSERT_EQ(registry.get<int>(entity), 1);
+    ASSERT_EQ(registry.get<int>(other), 2);
+    ASSERT_EQ(registry.get<char>(entity), 'c');
+    ASSERT_TRUE(registry.all_of<empty_type>(other));
+    ASSERT_EQ(registry.get<aggregate_type>(other).value, 3);
+
+    buffer.remove<int, char>(entity);
+    buffer.destroy(other);
+    buffer.flush();
+
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_FALSE(registry.valid(other));
+    ASSERT_FALSE((registry.any_of<int, char>(entity)));
+    ASSERT_EQ(registry.storage<int>().size(), 0u);
+}
+
+TEST(CommandBuffer, MoveOnly) {
+    entt::registry registry;
+    entt::command_buffer buffer{registry};
+
+    const auto entity = registry.create();
+    const auto other = buffer.create();
+
+    buffer.emplace<std::unique_ptr<int>>(entity, std::make_unique<int>(1));
+    buffer.emplace<std::unique_ptr<int>>(other, std::make_unique<int>(2));
+    buffer.flush();
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_TRUE((registry.all_of<std::unique_ptr<int>>(entity)));
+    ASSERT_TRUE((registry.all_of<std::unique_ptr<int>>(other)));
+    ASSERT_EQ(*registry.get<std::unique_ptr<int>>(entity), 1);
+    ASSERT_EQ(*registry.get<std::unique_ptr<int>>(other), 2);
+}
+
+TEST(CommandBuffer, Order) {
+    entt::registry registry;
+    entt::command_buffer buffer{registry};
+    const auto entity = registry.create();
+
+    buffer.emplace<int>(entity, 0);
+    buffer.remove<int>(entity);
+
+    const auto other = buffer.create();
+    buffer.emplace<int>(other, 1);
+    buffer.destroy(other);
+    buffer.flush();
+
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_FALSE(registry.valid(other));
+    ASSERT_FALSE(registry.all_of<int>(entity));
+    ASSERT_EQ(registry.storage<int>().size(), 0u);
+}
+
+TEST(CommandBuffer, Parallel) {
+    entt::registry registry;
+    entt::command_buffer buffer{registry};
+
+    for(int pos{}; pos < 3000; ++pos) {
+        registry.emplace<int>(registry.create(), pos);
+    }
+
+    registry.view<int>().each(test::thread_executor{}, [&buffer](const entt::entity entt, const int value) {
+        if(value % 2 == 0) {
+            buffer.remove<int>(entt);
+            buffer.emplace<char>(entt, static_cast<char>(value % 128));
+        }
+
+        if(value % 10 == 0) {
+            buffer.emplace<int>(buffer.create(), -value - 1);
+        }
+
+        if(value % 3 == 0) {
+            buffer.destroy(entt);
+        }
+    });
+
+    ASSERT_EQ(registry.storage<entt::entity>().reserved(), 300u);
+    ASSERT_EQ(registry.storage<int>().size(), 3000u);
+
+    buffer.flush();
+
+    ASSERT_TRUE(buffer.empty());
+    // odd values not multiple of 3 plus the newly created entities
+    ASSERT_EQ(registry.storage<int>().size(), 1000u + 300u);
+    // even values not multiple of 3
+    ASSERT_EQ(registry.storage<char>().size(), 1000u);
+
+    for(auto [entt, value]: registry.view<int>().each()) {
+        if(value < 0) {
+            ASSERT_EQ((value + 1) % 10, 0);
+        } else {
+            ASSERT_NE(value % 2, 0);
+            ASSERT_NE(value % 3, 0);
+        }
+    }
+
+    for(auto [entt, value]: registry.view<char>().each()) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)) % 128, value);
+    }
+}
@@ -1,14 +1,17 @@
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <iterator>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/group.hpp>
 #include <entt/entity/registry.hpp>
 #include "../common/config.h"
+#include "../common/thread_executor.hpp"
 
 struct empty_type {};
 
@@ -233,6 +236,41 @@ TEST(NonOwningGroup, Each) {
     }
 }
 
+TEST(NonOwningGroup, ParallelEach) {
+    entt::registry registry;
+    auto group = registry.group(entt::get<int, char>);
+    std::atomic<std::size_t> count{};
+
+    group.each(test::thread_executor{}, [&count](int &, char &) { ++count; });
+
+    ASSERT_EQ(count, 0u);
+
+    for(int pos{}; pos < 3000; ++pos) {
+        const auto entt = registry.create();
+        registry.emplace<int>(entt, pos);
+
+        if(pos % 3 != 0) {
+            registry.emplace<char>(entt);
+        }
+    }
+
+    group.each(test::thread_executor{}, [&count](const entt::entity entt, int &value, char &) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), value);
+        value *= 2;
+        ++count;
+    });
+
+    ASSERT_EQ(count, group.size());
+    ASSERT_EQ(count, 2000u);
+
+    group.each(test::thread_executor{2u}, [](int &value, char &) { ++value; });
+
+    for(auto [entt, value]: registry.view<int>().each()) {
+        const auto pos = static_cast<int>(entt::to_integral(entt));
+        ASSERT_EQ(value, (pos % 3 != 0) ? (pos * 2 + 1) : pos);
+    }
+}
+
 TEST(NonOwningGroup, Sort) {
     entt::registry registry;
     auto group = registry.group(entt::get<const int, unsigned int>);
@@ -982,6 +1020,41 @@ TEST(OwningGroup, Each) {
     }
 }
 
+TEST(OwningGroup, ParallelEach) {
+    entt::registry registry;
+    auto group = registry.group<int>(entt::get<char>);
+    std::atomic<std::size_t> count{};
+
+    group.each(test::thread_executor{}, [&count](int &, char &) { ++count; });
+
+    ASSERT_EQ(count, 0u);
+
+    for(int pos{}; pos < 3000; ++pos) {
+        const auto entt = registry.create();
+        registry.emplace<int>(entt, pos);
+
+        if(pos % 3 != 0) {
+            registry.emplace<char>(entt);
+        }
+    }
+
+    group.each(test::thread_executor{}, [&count](const entt::entity entt, int &value, char &) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), value);
+        value *= 2;
+        ++count;
+    });
+
+    ASSERT_EQ(count, group.size());
+    ASSERT_EQ(count, 2000u);
+
+    group.each(test::thread_executor{2u}, [](int &value, char &) { ++value; });
+
+    for(auto [entt, value]: registry.view<int>().each()) {
+        const auto pos = static_cast<int>(entt::to_integral(entt));
+        ASSERT_EQ(value, (pos % 3 != 0) ? (pos * 2 + 1) : pos);
+    }
+}
+
 TEST(OwningGroup, SortOrdered) {
     entt::registry registry;
     auto group = registry.group<boxed_int, char>();
@@ -1133,6 +1206,38 @@ TEST(OwningGroup, SortUnordered) {
     ASSERT_FALSE(group.contains(entity[6]));
 }
 
+TEST(OwningGroup, SortParallel) {
+    entt::registry registry;
+    auto group = registry.group<boxed_int, char>(entt::get<double>);
+
+    for(auto i = 0; i < 5000; ++i) {
+        const auto entity = registry.create();
+        registry.emplace<boxed_int>(entity, (i * 7919) % 5000);
+        registry.emplace<double>(entity, (i * 7919) % 5000);
+
+        if(i % 5) {
+            registry.emplace<char>(entity, static_cast<char>(i % 128));
+        }
+    }
+
+    group.sort<boxed_int>(test::thread_executor{}, [](const auto &lhs, const auto &rhs) { return lhs.value < rhs.value; });
+
+    ASSERT_EQ(group.size(), 4000u);
+
+    int prev = -1;
+
+    for(auto [entity, ivalue, cvalue, dvalue]: group.each()) {
+        ASSERT_LT(prev, ivalue.value);
+        ASSERT_EQ(static_cast<double>(ivalue.value), dvalue);
+        prev = ivalue.value;
+    }
+
+    for(std::size_t pos{}; pos < group.size(); ++pos) {
+        ASSERT_EQ(group.storage<char>()->data()[pos], group.handle().data()[pos]);
+        ASSERT_EQ(group.storage<double>()->data()[pos], group.handle().data()[pos]);
+    }
+}
+
 TEST(OwningGroup, SortWithExclusionList) {
     entt::registry registry;
     auto group = registry.group<boxed_int>(entt::get<>, entt::exclude<char>);
@@ -1636,11 +1741,91 @@ TEST(OwningGroup, Storage) {
     ASSERT_EQ(group.storage<const float>(), nullptr);
 }
 
+TEST(OwningGroup, Nested) {
+    entt::registry registry;
+    const auto check = [&registry](const auto &group, const auto &...cpool) {
+        const auto &leading = registry.storage<int>();
+        std::size_t count{};
+
+        for(auto entt: registry.view<int>()) {
+            count += group.contains(entt);
+            ASSERT_EQ(group.contains(entt), (cpool.contains(entt) && ...) && !registry.all_of<empty_type>(entt));
+        }
+
+        ASSERT_EQ(group.size(), count);
+
+        for(std::size_t pos{}; pos < group.size(); ++pos) {
+            ASSERT_TRUE(group.contains(leading.data()[pos]));
+            ASSERT_TRUE(((cpool.data()[pos] == leading.data()[pos]) && ...));
+        }
+    };
+
+    for(int pos{}; pos < 100; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, pos);
+        (pos % 2 == 0) ? void(registry.emplace<char>(entity)) : void();
+        (pos % 3 == 0) ? void(registry.emplace<double>(entity)) : void();
+        (pos % 5 == 0) ? void(registry.emplace<float>(entity)) : void();
+        (pos % 7 == 0) ? void(registry.emplace<empty_type>(entity)) : void();
+    }
+
+    // created out of order on purpose, nested groups are linked as they come
+    const auto middle = registry.group<int, char, double>(entt::get<>, entt::exclude<empty_type>);
+    const auto narrow = registry.group<int, char, double, float>(entt::get<>, entt::exclude<empty_type>);
+    const auto wide = registry.group<int, char>(entt::get<>, entt::exclude<empty_type>);
+
+    ASSERT_TRUE((registry.owned<int, char, double, float>()));
+
+    check(wide, registry.storage<char>());
+    check(middle, registry.storage<char>(), registry.storage<double>());
+    check(narrow, registry.storage<char>(), registry.storage<double>(), registry.storage<float>());
+
+    for(int pos{}; pos < 100; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<float>(entity);
+        registry.emplace<double>(entity);
+        registry.emplace<char>(entity);
+        registry.emplace<int>(entity, pos);
+    }
+
+    const std::vector<entt::entity> entities{registry.view<int>().begin(), registry.view<int>().end()};
+
+    for(auto entt: entities) {
+        if(const auto value = registry.get<int>(entt); value % 4 == 0) {
+            registry.remove<double>(entt);
+        } else if(value % 11 == 0) {
+            registry.emplace_or_replace<empty_type>(entt);
+        } else if(value % 13 == 0) {
+            registry.remove<empty_type>(entt);
+        }
+    }
+
+    registry.destroy(registry.view<int>().front());
+    registry.destroy(registry.view<float>().back());
+
+    check(wide, registry.storage<char>());
+    check(middle, registry.storage<char>(), registry.storage<double>());
+    check(narrow, registry.storage<char>(), registry.storage<double>(), registry.storage<float>());
+
+    ASSERT_LE(narrow.size(), middle.size());
+    ASSERT_LE(middle.size(), wide.size());
+}
+
+ENTT_DEBUG_TEST(OwningGroupDeathTest, SortNested) {
+    entt::registry registry;
+    const auto group = registry.group<int>(entt::get<char>);
+    const auto nested = registry.group<int, char>();
+
+    nested.sort([](const entt::entity lhs, const entt::entity rhs) { return lhs < rhs; });
+
+    ASSERT_DEATH(group.sort([](const entt::entity lhs, const entt::entity rhs) { return lhs < rhs; }), "");
+}
+
 ENTT_DEBUG_TEST(OwningGroupDeathTest, Overlapping) {
     entt::registry registry;
     registry.group<char>(entt::get<int>, entt::exclude<double>);
 
     ASSERT_DEATH((registry.group<char, float>(entt::get<float>, entt::exclude<double>)), "");
-    ASSERT_DEATH(registry.group<char>(entt::get<int, float>, entt::exclude<double>), "");
-    ASSERT_DEATH(registry.group<char>(entt::get<int>, entt::exclude<double, float>), "");
+    ASSERT_DEATH(registry.group<char>(entt::get<float>, entt::exclude<double>), "");
+    ASSERT_DEATH((registry.group<char, int>(entt::get<>, entt::exclude<float>)), "");
 }
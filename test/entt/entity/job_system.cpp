@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/job_system.hpp>
+#include <entt/entity/organizer.hpp>
+#include <entt/entity/registry.hpp>
+
+struct tracker {
+    void track(const std::size_t value) {
+        std::lock_guard guard{mutex};
+        order.push_back(value);
+    }
+
+    std::mutex mutex{};
+    std::vector<std::size_t> order{};
+};
+
+void rw_int(entt::view<entt::get_t<int>> view, tracker &ctx) {
+    for(auto [entt, value]: view.each()) {
+        ++value;
+    }
+
+    ctx.track(0u);
+}
+
+void ro_int_rw_char(entt::view<entt::get_t<const int, char>> view, tracker &ctx) {
+    for(auto [entt, ivalue, cvalue]: view.each()) {
+        cvalue = static_cast<char>(ivalue);
+    }
+
+    ctx.track(1u);
+}
+
+void ro_int_rw_double(entt::view<entt::get_t<const int, double>> view, tracker &ctx) {
+    for(auto [entt, ivalue, dvalue]: view.each()) {
+        dvalue = ivalue;
+    }
+
+    ctx.track(2u);
+}
+
+void ro_char_double(entt::view<entt::get_t<const char, const double>> view, tracker &ctx) {
+    for(auto [entt, cvalue, dvalue]: view.each()) {
+        ASSERT_EQ(static_cast<double>(cvalue), dvalue);
+    }
+
+    ctx.track(3u);
+}
+
+TEST(JobSystem, Run) {
+    entt::organizer organizer;
+
+    // the context variable is shared, hence the explicit read-only request
+    organizer.emplace<&rw_int, const tracker>("t0");
+    organizer.emplace<&ro_int_rw_char, const tracker>("t1");
+    organizer.emplace<&ro_int_rw_double, const tracker>("t2");
+    organizer.emplace<&ro_char_double, const tracker>("t3");
+
+    for(std::size_t workers: {0u, 1u, 4u}) {
+        entt::registry registry;
+        entt::job_system job_system{organizer.graph(), workers};
+
+        ASSERT_EQ(job_system.size(), workers + 1u);
+        ASSERT_EQ(job_system.graph().size(), 4u);
+
+        for(int pos{}; pos < 100; ++pos) {
+            const auto entt = registry.create();
+            registry.emplace<int>(entt, pos);
+            registry.emplace<char>(entt);
+            registry.emplace<double>(entt);
+        }
+
+        for(std::size_t frame{}; frame < 8u; ++frame) {
+            auto &ctx = registry.ctx().emplace<tracker>();
+            ctx.order.clear();
+
+            job_system.run(registry);
+
+            ASSERT_EQ(ctx.order.size(), 4u);
+            ASSERT_EQ(ctx.order.front(), 0u);
+            ASSERT_EQ(ctx.order.back(), 3u);
+        }
+
+        for(auto [entt, ivalue, cvalue, dvalue]: registry.view<int, char, double>().each()) {
+            ASSERT_EQ(ivalue, static_cast<int>(entt::to_integral(entt)) + 8);
+            ASSERT_EQ(static_cast<int>(cvalue), ivalue);
+            ASSERT_EQ(static_cast<int>(dvalue), ivalue);
+        }
+    }
+}
+
+TEST(JobSystem, Sequence) {
+    entt::organizer organizer;
+    entt::registry registry;
+    std::size_t value[16u]{};
+
+    // raw functions access the registry in read-write mode and run in sequence
+    for(auto &&elem: value) {
+        organizer.emplace(+[](const void *payload, entt::registry &reg) { *static_cast<std::size_t *>(const_cast<void *>(payload)) = reg.ctx().get<std::size_t>()++; }, &elem);
+    }
+
+    registry.ctx().emplace<std::size_t>();
+
+    for(std::size_t workers: {0u, 1u, 4u}) {
+        entt::job_system job_system{organizer.graph(), workers};
+        registry.ctx().get<std::size_t>() = 0u;
+
+        job_system.run(registry);
+
+        for(std::size_t pos{}; pos < 16u; ++pos) {
+            ASSERT_EQ(value[pos], pos);
+        }
+    }
+}
+
+TEST(JobSystem, Empty) {
+    entt::registry registry;
+    entt::job_system job_system{{}, 2u};
+
+    ASSERT_TRUE(job_system.graph().empty());
+    ASSERT_NO_FATAL_FAILURE(job_system.run(registry));
+}
+
+TEST(JobSystem, Assign) {
+    entt::organizer organizer;
+    entt::registry registry;
+    entt::job_system job_system{};
+
+    ASSERT_GE(job_system.size(), 1u);
+    ASSERT_TRUE(job_system.graph().empty());
+
+    organizer.emplace<&rw_int, const tracker>("t0");
+    job_system.assign(organizer.graph());
+    registry.emplace<int>(registry.create(), 0);
+
+    ASSERT_EQ(job_system.graph().size(), 1u);
+
+    job_system.run(registry);
+
+    ASSERT_EQ(registry.ctx().get<tracker>().order.size(), 1u);
+    ASSERT_EQ(registry.get<int>(registry.view<int>().front()), 1);
+}
+
+TEST(JobSystem, Record) {
+    entt::organizer organizer;
+    entt::registry registry;
+
+    organizer.emplace<&rw_int, const tracker>("t0");
+    organizer.emplace<&ro_int_rw_char, const tracker>("t1");
+    organizer.emplace<&ro_int_rw_double, const tracker>("t2");
+    organizer.emplace<&ro_char_double, const tracker>("t3");
+
+    entt::job_system job_system{organizer.graph(), 1u};
+
+    ASSERT_EQ(job_system.graph()[1u].cost(), 1.);
+    ASSERT_EQ(job_system.graph()[0u].priority(), 3.);
+
+    job_system.record(.5);
+    job_system.run(registry);
+    job_system.run(registry);
+
+    ASSERT_EQ(registry.ctx().get<tracker>().order.size(), 8u);
+
+    const auto &graph = job_system.graph();
+
+    ASSERT_EQ(graph[3u].priority(), graph[3u].cost());
+    ASSERT_EQ(graph[1u].priority(), graph[1u].cost() + graph[3u].priority());
+    ASSERT_EQ(graph[0u].priority(), graph[0u].cost() + (std::max)(graph[1u].priority(), graph[2u].priority()));
+    ASSERT_TRUE(graph[0u].critical());
+    ASSERT_TRUE(graph[3u].critical());
+
+    job_system.record(0.);
+    const auto cost = job_system.graph()[0u].cost();
+    job_system.run(registry);
+
+    ASSERT_EQ(job_system.graph()[0u].cost(), cost);
+}
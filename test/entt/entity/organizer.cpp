@@ -532,3 +532,49 @@ TEST(Organizer, ToArgsIntegrity) {
 
     ASSERT_EQ(registry.ctx().get<std::size_t>(), 0u);
 }
+
+TEST(Organizer, Prioritize) {
+    entt::organizer organizer;
+
+    organizer.emplace<&ro_int_rw_char_double>("t1");
+    organizer.emplace<&ro_char_rw_int>("t2");
+    organizer.emplace<&ro_char_rw_double>("t3");
+    organizer.emplace<&ro_int_double>("t4");
+
+    auto graph = organizer.graph();
+
+    ASSERT_EQ(graph.size(), 4u);
+
+    ASSERT_EQ(graph[0u].cost(), 1.);
+    ASSERT_EQ(graph[3u].cost(), 1.);
+
+    ASSERT_EQ(graph[0u].earliest_start(), 0.);
+    ASSERT_EQ(graph[1u].earliest_start(), 1.);
+    ASSERT_EQ(graph[2u].earliest_start(), 1.);
+    ASSERT_EQ(graph[3u].earliest_start(), 2.);
+
+    ASSERT_EQ(graph[0u].priority(), 3.);
+    ASSERT_EQ(graph[1u].priority(), 2.);
+    ASSERT_EQ(graph[2u].priority(), 2.);
+    ASSERT_EQ(graph[3u].priority(), 1.);
+
+    ASSERT_TRUE(graph[0u].critical());
+    ASSERT_TRUE(graph[1u].critical());
+    ASSERT_FALSE(graph[2u].critical());
+    ASSERT_TRUE(graph[3u].critical());
+
+    graph[2u].cost(5.);
+    entt::organizer::prioritize(graph);
+
+    ASSERT_EQ(graph[2u].cost(), 5.);
+    ASSERT_EQ(graph[3u].earliest_start(), 6.);
+
+    ASSERT_EQ(graph[0u].priority(), 7.);
+    ASSERT_EQ(graph[1u].priority(), 2.);
+    ASSERT_EQ(graph[2u].priority(), 6.);
+
+    ASSERT_TRUE(graph[0u].critical());
+    ASSERT_FALSE(graph[1u].critical());
+    ASSERT_TRUE(graph[2u].critical());
+    ASSERT_TRUE(graph[3u].critical());
+}
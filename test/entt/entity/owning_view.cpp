@@ -0,0 +1,245 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/owning_view.hpp>
+#include <entt/entity/registry.hpp>
+#include "../common/thread_executor.hpp"
+
+TEST(OwningView, Functionalities) {
+    entt::registry registry;
+    std::vector<entt::entity> expected{};
+
+    for(int pos{}; pos < 100; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, pos);
+
+        if(pos % 3 == 0) {
+            registry.emplace<char>(entity, static_cast<char>(pos));
+            expected.push_back(entity);
+        }
+    }
+
+    auto view = registry.owning_view<int, char>();
+
+    ASSERT_TRUE(view);
+    ASSERT_FALSE(view.owned());
+    ASSERT_TRUE((registry.owned<int, char>()));
+    ASSERT_EQ(view.size_hint(), registry.storage<char>().size());
+
+    std::vector<entt::entity> visited{};
+
+    view.each([&visited](const auto entity, const int value, const char elem) {
+        ASSERT_EQ(value % 3, 0);
+        ASSERT_EQ(static_cast<char>(value), elem);
+        visited.push_back(entity);
+    });
+
+    ASSERT_TRUE(view.owned());
+    ASSERT_EQ(view.size_hint(), expected.size());
+    ASSERT_EQ(visited.size(), expected.size());
+    ASSERT_TRUE(std::is_permutation(visited.cbegin(), visited.cend(), expected.cbegin()));
+
+    for(auto entity: expected) {
+        ASSERT_LT(registry.storage<int>().index(entity), expected.size());
+        ASSERT_EQ(registry.storage<int>().index(entity), registry.storage<char>().index(entity));
+    }
+
+    const auto entity = registry.create();
+    registry.emplace<char>(entity, 'c');
+    registry.emplace<int>(entity, 99);
+
+    ASSERT_EQ(view.size_hint(), expected.size() + 1u);
+    ASSERT_TRUE(view.group().contains(entity));
+    ASSERT_TRUE(view.contains(entity));
+
+    registry.erase<char>(expected.front());
+
+    ASSERT_EQ(view.size_hint(), expected.size());
+    ASSERT_FALSE(view.group().contains(expected.front()));
+    ASSERT_FALSE(view.contains(expected.front()));
+}
+
+TEST(OwningView, Invalid) {
+    entt::owning_view<entt::owned_t<int, char>> view{};
+
+    ASSERT_FALSE(view);
+    ASSERT_FALSE(view.owned());
+    ASSERT_FALSE(view.group());
+    ASSERT_EQ(view.size_hint(), 0u);
+
+    view.each([](auto &&...) { FAIL(); });
+}
+
+TEST(OwningView, Exclude) {
+    entt::registry registry;
+
+    for(int pos{}; pos < 10; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, pos);
+
+        if(pos % 2 == 0) {
+            registry.emplace<char>(entity);
+        }
+    }
+
+    auto view = registry.owning_view<int>(entt::exclude<char>);
+    std::size_t count{};
+
+    view.each([&count](const int value) {
+        ASSERT_NE(value % 2, 0);
+        ++count;
+    });
+
+    ASSERT_TRUE(view.owned());
+    ASSERT_EQ(count, 5u);
+
+    registry.remove<char>(registry.view<char>().front());
+
+    ASSERT_EQ(view.size_hint(), 6u);
+}
+
+TEST(OwningView, SameHandler) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    registry.emplace<int>(entity);
+    registry.emplace<char>(entity);
+
+    auto view = registry.owning_view<int, char>();
+    const auto other = registry.owning_view<int, char>();
+
+    view.each([](auto &&...) {});
+
+    ASSERT_TRUE(view.owned());
+    ASSERT_TRUE(other.owned());
+}
+
+TEST(OwningView, ReleaseOnConflict) {
+    entt::registry registry;
+
+    for(int pos{}; pos < 10; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, pos);
+        registry.emplace<char>(entity);
+
+        if(pos % 2 == 0) {
+            registry.emplace<double>(entity);
+        }
+    }
+
+    auto view = registry.owning_view<int, char>();
+    std::size_t count{};
+
+    view.each([&count](int, char) { ++count; });
+
+    ASSERT_TRUE(view.owned());
+    ASSERT_EQ(count, 10u);
+
+    const auto group = registry.group<int, double>();
+
+    ASSERT_FALSE(view.owned());
+    ASSERT_FALSE(view.group());
+    ASSERT_FALSE(registry.owned<char>());
+    ASSERT_EQ(group.size(), 5u);
+
+    count = 0u;
+    view.each([&count](int, char) { ++count; });
+
+    ASSERT_FALSE(view.owned());
+    ASSERT_EQ(count, 10u);
+
+    registry.emplace<double>(registry.view<int>(entt::exclude<double>).front());
+
+    ASSERT_EQ(group.size(), 6u);
+}
+
+TEST(OwningView, GroupOutlivesRelease) {
+    entt::registry registry;
+
+    for(int pos{}; pos < 4; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, pos);
+        registry.emplace<char>(entity);
+        registry.emplace<double>(entity);
+    }
+
+    auto view = registry.owning_view<int, char>();
+    const auto group = view.group();
+
+    ASSERT_TRUE(group);
+    ASSERT_EQ(group.size(), 4u);
+
+    const auto other = registry.group<int, double>();
+
+    ASSERT_FALSE(view.owned());
+    ASSERT_FALSE(view.group());
+    ASSERT_EQ(other.size(), 4u);
+
+    ASSERT_TRUE(group);
+    ASSERT_EQ(group.size(), 0u);
+    ASSERT_EQ(group.begin(), group.end());
+
+    group.each([](auto &&...) { FAIL(); });
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity);
+    registry.emplace<char>(entity);
+    registry.clear<char>();
+
+    ASSERT_EQ(group.size(), 0u);
+    ASSERT_EQ(view.size_hint(), 0u);
+}
+
+TEST(OwningView, ConflictingGroup) {
+    entt::registry registry;
+    const auto group = registry.group<int>(entt::get<char>);
+    auto view = registry.owning_view<char, int>();
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity);
+    registry.emplace<char>(entity);
+
+    ASSERT_EQ(group.size(), 1u);
+
+    std::size_t count{};
+    view.each([&count](char, int) { ++count; });
+
+    ASSERT_FALSE(view.owned());
+    ASSERT_EQ(count, 1u);
+
+    auto other = registry.owning_view<char>();
+    other.each([](char) {});
+
+    ASSERT_TRUE(other.owned());
+
+    auto conflicting = registry.owning_view<char, double>();
+    conflicting.each([](char, double) {});
+
+    ASSERT_TRUE(other.owned());
+    ASSERT_FALSE(conflicting.owned());
+}
+
+TEST(OwningView, ParallelEach) {
+    entt::registry registry;
+
+    for(int pos{}; pos < 3000; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, pos);
+
+        if(pos % 2 == 0) {
+            registry.emplace<char>(entity);
+        }
+    }
+
+    auto view = registry.owning_view<int, char>();
+    std::atomic<std::size_t> count{};
+
+    view.each(test::thread_executor{}, [&count](int &value, char) {
+        ASSERT_EQ(value % 2, 0);
+        ++count;
+    });
+
+    ASSERT_TRUE(view.owned());
+    ASSERT_EQ(count, 1500u);
+}
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <iterator>
@@ -5,12 +6,15 @@
 #include <tuple>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/hashed_string.hpp>
 #include <entt/core/type_info.hpp>
 #include <entt/entity/entity.hpp>
 #include <entt/entity/registry.hpp>
+#include <entt/entity/runtime_view.hpp>
 #include "../common/config.h"
+#include "../common/thread_executor.hpp"
 
 struct empty_type {};
 
@@ -38,6 +42,13 @@ struct aggregate {
     int value{};
 };
 
+struct soa_type {
+    int value;
+    char other;
+
+    using soa_members = entt::value_list<&soa_type::value, &soa_type::other>;
+};
+
 struct listener {
     template<typename Type>
     static void sort(entt::registry &registry) {
@@ -54,6 +65,13 @@ struct listener {
         --counter;
     }
 
+    void batch(const entt::registry &, const entt::entity *from, const entt::entity *to) {
+        counter += static_cast<int>(to - from);
+        ++batches;
+    }
+
+    int batches{0};
+
     entt::entity last{entt::null};
     int counter{0};
 };
@@ -1165,11 +1183,11 @@ TEST(Registry, CleanPartialOwningGroupViewAfterRemoveAndClear) {
 ENTT_DEBUG_TEST(RegistryDeathTest, NestedGroups) {
     entt::registry registry;
     registry.group<int, double>(entt::get<char>);
+    registry.group<int>(entt::get<char>);
 
-    ASSERT_DEATH(registry.group<int>(entt::get<char>), "");
-    ASSERT_DEATH(registry.group<int>(entt::get<char, double>), "");
     ASSERT_DEATH(registry.group<int>(entt::get<char>, entt::exclude<double>), "");
-    ASSERT_DEATH((registry.group<int, double>()), "");
+    ASSERT_DEATH((registry.group<int, float>(entt::get<char>)), "");
+    ASSERT_DEATH((registry.group<double, float>()), "");
 }
 
 ENTT_DEBUG_TEST(RegistryDeathTest, ConflictingGroups) {
@@ -1231,6 +1249,30 @@ TEST(Registry, SortMulti) {
     }
 }
 
+TEST(Registry, SortParallel) {
+    entt::registry registry;
+
+    for(auto i = 0; i < 5000; ++i) {
+        const auto entity = registry.create();
+        registry.emplace<unsigned int>(entity, static_cast<unsigned int>(i));
+        registry.emplace<int>(entity, i);
+    }
+
+    registry.sort<unsigned int>(test::thread_executor{}, std::less<unsigned int>{});
+    registry.sort<int, unsigned int>(test::thread_executor{});
+
+    unsigned int uval = 0u;
+    int ival = 0;
+
+    for(auto entity: registry.view<unsigned int>()) {
+        ASSERT_EQ(registry.get<unsigned int>(entity), uval++);
+    }
+
+    for(auto entity: registry.view<int>()) {
+        ASSERT_EQ(registry.get<int>(entity), ival++);
+    }
+}
+
 TEST(Registry, SortEmpty) {
     entt::registry registry;
 
@@ -1367,6 +1409,37 @@ TEST(Registry, Signals) {
     ASSERT_EQ(listener.last, entity[0u]);
 }
 
+TEST(Registry, RangeSignals) {
+    entt::registry registry;
+    entt::entity entity[3u]{};
+    listener listener;
+
+    const auto group = registry.group<int>(entt::get<char>);
+    registry.on_construct_range<int>().connect<&listener::batch>(listener);
+    registry.on_destroy_range<int>().connect<&listener::batch>(listener);
+
+    registry.create(std::begin(entity), std::end(entity));
+    registry.insert<char>(std::begin(entity), std::end(entity));
+    registry.insert<int>(std::begin(entity), std::end(entity));
+
+    ASSERT_EQ(listener.batches, 1);
+    ASSERT_EQ(listener.counter, 3);
+    ASSERT_EQ(group.size(), 3u);
+
+    registry.emplace<int>(registry.create());
+
+    ASSERT_EQ(listener.batches, 2);
+    ASSERT_EQ(listener.counter, 4);
+    ASSERT_EQ(group.size(), 3u);
+
+    registry.destroy(std::begin(entity), std::end(entity));
+
+    ASSERT_EQ(listener.batches, 3);
+    ASSERT_EQ(listener.counter, 7);
+    ASSERT_EQ(group.size(), 0u);
+    ASSERT_EQ(registry.storage<int>().size(), 1u);
+}
+
 TEST(Registry, SignalsOnRuntimePool) {
     using namespace entt::literals;
 
@@ -1728,6 +1801,30 @@ TEST(Registry, Remove) {
     ASSERT_TRUE(registry.orphan(entity[2u]));
 }
 
+TEST(Registry, BulkRemove) {
+    entt::registry registry;
+    std::vector<entt::entity> entity(64u);
+
+    registry.create(entity.begin(), entity.end());
+    registry.insert<int>(entity.begin(), entity.end());
+    registry.insert<char>(entity.begin() + 32u, entity.end());
+
+    const std::vector<entt::entity> doomed(entity.begin() + 16u, entity.end());
+
+    ASSERT_EQ((registry.remove<int, char>(doomed.begin(), doomed.end())), 80u);
+    ASSERT_EQ(registry.storage<int>().size(), 16u);
+    ASSERT_TRUE(registry.storage<char>().empty());
+
+    for(auto entt: registry.view<int>()) {
+        ASSERT_LT(registry.storage<int>().index(entt), 16u);
+        ASSERT_EQ(std::find(doomed.cbegin(), doomed.cend(), entt), doomed.cend());
+    }
+
+    registry.erase<int>(entity.begin(), entity.begin() + 16u);
+
+    ASSERT_TRUE(registry.storage<int>().empty());
+}
+
 TEST(Registry, StableRemove) {
     entt::registry registry;
     const auto iview = registry.view<int>();
@@ -1805,6 +1902,136 @@ TEST(Registry, Compact) {
     ASSERT_EQ(registry.storage<stable_type>().size(), 0u);
 }
 
+TEST(Registry, IncrementalCompact) {
+    entt::registry registry;
+    entt::entity entity[4u];
+
+    registry.create(std::begin(entity), std::end(entity));
+    registry.insert<stable_type>(std::begin(entity), std::end(entity));
+    registry.insert<aggregate>(std::begin(entity), std::end(entity));
+    registry.destroy(std::begin(entity), std::begin(entity) + 3u);
+
+    ASSERT_EQ(registry.storage<stable_type>().tombstones(), 3u);
+    ASSERT_EQ(registry.storage<aggregate>().tombstones(), 0u);
+    ASSERT_EQ(registry.compact<stable_type>(2u), 2u);
+    ASSERT_EQ(registry.storage<stable_type>().size(), 4u);
+    ASSERT_EQ(registry.compact(2u), 1u);
+    ASSERT_EQ(registry.storage<stable_type>().size(), 1u);
+    ASSERT_EQ(registry.storage<stable_type>().tombstones(), 0u);
+    ASSERT_TRUE(registry.all_of<stable_type>(entity[3u]));
+}
+
+TEST(Registry, DisableEnable) {
+    entt::registry registry;
+    entt::entity entity[3u];
+
+    registry.create(std::begin(entity), std::end(entity));
+    registry.insert<int>(std::begin(entity), std::end(entity));
+    registry.insert<stable_type>(std::begin(entity), std::end(entity));
+    registry.emplace<char>(entity[1u]);
+
+    registry.disable(entity[1u]);
+
+    ASSERT_TRUE(registry.valid(entity[1u]));
+    ASSERT_FALSE(registry.enabled(entity[1u]));
+    ASSERT_TRUE(registry.enabled(entity[0u]));
+    ASSERT_TRUE((registry.all_of<int, char>(entity[1u])));
+    ASSERT_EQ(registry.storage<int>().disabled(), 1u);
+    ASSERT_EQ(registry.storage<stable_type>().disabled(), 1u);
+    ASSERT_FALSE(registry.view<stable_type>().contains(entity[1u]));
+    ASSERT_EQ(registry.view<int>().size(), 2u);
+    ASSERT_FALSE(registry.view<int>().contains(entity[1u]));
+    ASSERT_FALSE((registry.view<int, char>().contains(entity[1u])));
+    ASSERT_EQ(registry.view<entt::entity>().size(), 2u);
+
+    registry.view<int>().each([&entity](const auto entt, auto &) { ASSERT_NE(entt, entity[1u]); });
+
+    registry.enable(entity[1u]);
+
+    ASSERT_TRUE(registry.enabled(entity[1u]));
+    ASSERT_EQ(registry.view<int>().size(), 3u);
+    ASSERT_TRUE((registry.view<int, char>().contains(entity[1u])));
+
+    registry.disable(entity[0u]);
+    registry.disable(entity[2u]);
+    registry.destroy(entity[2u]);
+
+    ASSERT_FALSE(registry.valid(entity[2u]));
+    ASSERT_EQ(registry.storage<int>().disabled(), 1u);
+    ASSERT_EQ(registry.storage<entt::entity>().disabled(), 1u);
+
+    registry.destroy(std::begin(entity), std::begin(entity) + 2u);
+
+    ASSERT_EQ(registry.storage<int>().disabled(), 0u);
+    ASSERT_EQ(registry.storage<entt::entity>().disabled(), 0u);
+    ASSERT_TRUE(registry.storage<int>().empty());
+}
+
+TEST(Registry, DisableEnableAcrossPools) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<int>(entity);
+    registry.emplace<int>(other);
+    registry.emplace<char>(other);
+    registry.emplace<stable_type>(other);
+
+    const auto group = registry.group(entt::get<int, char>);
+
+    registry.disable(entity);
+    registry.emplace<char>(entity);
+    registry.emplace<stable_type>(entity);
+
+    ASSERT_FALSE(registry.storage<char>().enabled(entity));
+    ASSERT_FALSE(registry.storage<stable_type>().enabled(entity));
+
+    auto view = registry.view<int, char>();
+
+    const auto check = [&]() {
+        ASSERT_FALSE(view.contains(entity));
+        ASSERT_EQ(view.front(), other);
+        ASSERT_EQ(std::distance(view.begin(), view.end()), 1);
+
+        view.each([other](const auto entt, auto &&...) { ASSERT_EQ(entt, other); });
+    };
+
+    view.use<int>();
+    check();
+
+    view.use<char>();
+    check();
+
+    entt::runtime_view runtime{};
+    runtime.iterate(registry.storage<stable_type>()).iterate(registry.storage<int>());
+
+    ASSERT_FALSE(runtime.contains(entity));
+    ASSERT_EQ(std::distance(runtime.begin(), runtime.end()), 1);
+
+    runtime.each([other](const auto entt) { ASSERT_EQ(entt, other); });
+
+    ASSERT_EQ(group.size(), 1u);
+    ASSERT_FALSE(group.contains(entity));
+
+    registry.enable(entity);
+
+    ASSERT_TRUE((registry.view<int, char, stable_type>().contains(entity)));
+    ASSERT_TRUE(runtime.contains(entity));
+    ASSERT_EQ(group.size(), 2u);
+    ASSERT_TRUE(group.contains(entity));
+}
+
+ENTT_DEBUG_TEST(RegistryDeathTest, DisableOwned) {
+    entt::registry registry;
+    const auto entity = registry.create();
+
+    registry.emplace<int>(entity);
+    registry.group<int>(entt::get<char>);
+
+    ASSERT_FALSE(registry.all_of<char>(entity));
+    ASSERT_DEATH(registry.disable(entity), "");
+}
+
 TEST(Registry, NonOwningGroupInterleaved) {
     entt::registry registry;
     typename entt::entity entity = entt::null;
@@ -2234,6 +2461,59 @@ TEST(Registry, NoEtoType) {
     ASSERT_EQ((std::get<0>(view.get<no_eto_type, int>(entity))), (std::get<0>(cview.get<const no_eto_type, const int>(entity))));
 }
 
+TEST(Registry, StructureOfArrays) {
+    entt::registry registry;
+    const entt::entity entity[2u]{registry.create(), registry.create()};
+    listener listener;
+
+    registry.on_update<soa_type>().connect<&listener::incr>(listener);
+
+    registry.emplace<soa_type>(entity[0u], 1, 'a');
+    registry.emplace<int>(entity[0u], 42);
+    registry.emplace<soa_type>(entity[1u], 2, 'b');
+
+    ASSERT_EQ(registry.get<soa_type>(entity[0u]), std::make_tuple(1, 'a'));
+
+    registry.replace<soa_type>(entity[0u], 3, 'c');
+    registry.emplace_or_replace<soa_type>(entity[1u], 4, 'd');
+    registry.patch<soa_type>(entity[1u], [](auto &elem) { ++elem.value; });
+
+    ASSERT_EQ(listener.counter, 3);
+    ASSERT_EQ(registry.get<soa_type>(entity[0u]), std::make_tuple(3, 'c'));
+    ASSERT_EQ(std::as_const(registry).get<const soa_type>(entity[1u]), std::make_tuple(5, 'd'));
+
+    std::size_t count{};
+
+    registry.view<soa_type>().each([&count](auto, int &value, char &other) {
+        value *= 2;
+        count += (other == 'c' || other == 'd');
+    });
+
+    ASSERT_EQ(count, 2u);
+
+    for(auto [entt, value, other, elem]: std::as_const(registry).view<const soa_type, const int>().each()) {
+        ASSERT_EQ(entt, entity[0u]);
+        ASSERT_EQ(value, 6);
+        ASSERT_EQ(other, 'c');
+        ASSERT_EQ(elem, 42);
+    }
+
+    auto group = registry.group<soa_type>(entt::get<int>);
+
+    ASSERT_EQ(group.size(), 1u);
+
+    for(auto [entt, value, other, elem]: group.each()) {
+        ASSERT_EQ(entt, entity[0u]);
+        ASSERT_EQ(value, 6);
+        ASSERT_EQ(other, 'c');
+        ASSERT_EQ(elem, 42);
+    }
+
+    registry.destroy(entity[0u]);
+
+    ASSERT_EQ(registry.get<soa_type>(entity[1u]), std::make_tuple(10, 'd'));
+}
+
 TEST(Registry, CtxAndPoolMemberDestructionOrder) {
     auto registry = std::make_unique<entt::registry>();
     const auto entity = registry->create();
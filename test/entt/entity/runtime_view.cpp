@@ -1,4 +1,7 @@
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 #include <utility>
 #include <gtest/gtest.h>
 #include <entt/entity/entity.hpp>
@@ -10,6 +13,23 @@ struct stable_type {
     int value;
 };
 
+enum class indexed_entity : std::uint32_t {};
+
+struct indexed_entity_traits {
+    using value_type = indexed_entity;
+    using entity_type = std::uint32_t;
+    using version_type = std::uint16_t;
+    static constexpr entity_type entity_mask = 0xFFFFF;
+    static constexpr entity_type version_mask = 0xFFF;
+};
+
+template<>
+struct entt::entt_traits<indexed_entity>: entt::basic_entt_traits<indexed_entity_traits> {
+    using base_type = entt::basic_entt_traits<indexed_entity_traits>;
+    static constexpr std::size_t page_size = ENTT_SPARSE_PAGE;
+    static constexpr bool presence_index = true;
+};
+
 template<typename Type>
 struct RuntimeView: testing::Test {
     using type = Type;
@@ -303,6 +323,99 @@ TYPED_TEST(RuntimeView, EachWithHoles) {
     });
 }
 
+TYPED_TEST(RuntimeView, EachWithPresenceIndex) {
+    using common_type = typename TestFixture::type::common_type;
+    using sparse_set_type = std::conditional_t<std::is_const_v<common_type>, const entt::basic_sparse_set<indexed_entity>, entt::basic_sparse_set<indexed_entity>>;
+
+    entt::basic_registry<indexed_entity> registry;
+    entt::basic_runtime_view<sparse_set_type> view{};
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.emplace<char>(e0, '0');
+    registry.emplace<char>(e1, '1');
+    registry.emplace<char>(e2, '2');
+
+    registry.emplace<int>(e0, 0);
+    registry.emplace<int>(e2, 2);
+
+    registry.emplace<double>(e2);
+
+    registry.storage<char>().presence_index(true);
+
+    view.iterate(registry.storage<char>()).iterate(registry.storage<int>()).exclude(registry.storage<double>());
+
+    std::size_t count{};
+
+    view.each([&count, e0](auto entt) {
+        ASSERT_EQ(e0, entt);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 1u);
+}
+
+TYPED_TEST(RuntimeView, EachBlock) {
+    using runtime_view_type = typename TestFixture::type;
+    using block_type = typename runtime_view_type::block_type;
+
+    entt::registry registry;
+    runtime_view_type view{};
+    std::size_t expected{};
+
+    for(int pos{}; pos < 200; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, pos);
+
+        if(pos % 3 != 0) {
+            registry.emplace<char>(entity, static_cast<char>(pos));
+            expected += (pos % 5 != 0);
+        }
+
+        if(pos % 5 == 0) {
+            registry.emplace<double>(entity);
+        }
+    }
+
+    auto &istorage = registry.storage<int>();
+    auto &cstorage = registry.storage<char>();
+
+    view.iterate(istorage).iterate(cstorage).exclude(registry.storage<double>());
+
+    std::size_t count{};
+    std::size_t blocks{};
+
+    view.each_block([&](block_type &block) {
+        ASSERT_NE(block.size(), 0u);
+        ASSERT_LE(block.size(), block_type::block_size);
+
+        const auto *index = block.index(istorage);
+        const auto *value = block.value(istorage);
+        const auto *other = block.value(cstorage);
+
+        for(std::size_t pos{}; pos < block.size(); ++pos) {
+            const auto entity = block.data()[pos];
+
+            ASSERT_TRUE(view.contains(entity));
+            ASSERT_EQ(index[pos], istorage.index(entity));
+            ASSERT_EQ(block.index(cstorage)[pos], cstorage.index(entity));
+            ASSERT_EQ(*static_cast<const int *>(value[pos]), registry.get<int>(entity));
+            ASSERT_EQ(*static_cast<const char *>(other[pos]), registry.get<char>(entity));
+        }
+
+        count += block.size();
+        ++blocks;
+    });
+
+    ASSERT_EQ(count, expected);
+    ASSERT_EQ(blocks, (expected + block_type::block_size - 1u) / block_type::block_size);
+
+    view.clear();
+    view.each_block([](auto &&) { FAIL(); });
+}
+
 TYPED_TEST(RuntimeView, ExcludedComponents) {
     using runtime_view_type = typename TestFixture::type;
 
@@ -31,6 +31,15 @@ void listener(counter &counter, Registry &, typename Registry::entity_type) {
     ++counter.value;
 }
 
+template<typename Registry>
+void range_listener(counter &counter, Registry &, const typename Registry::entity_type *first, const typename Registry::entity_type *last) {
+    counter.value += static_cast<int>(last - first);
+}
+
+void batch_listener(std::size_t &count, entt::registry &, const entt::entity *, const entt::entity *) {
+    ++count;
+}
+
 struct empty_each_tag final {};
 
 template<>
@@ -336,6 +345,69 @@ TEST(SighMixin, VoidType) {
     ASSERT_EQ(on_destroy.value, 1);
 }
 
+TEST(SighMixin, RangeSignals) {
+    entt::entity entity[3u]{entt::entity{3}, entt::entity{42}, entt::entity{7}};
+    entt::sigh_mixin<entt::storage<int>> pool;
+    entt::sparse_set &base = pool;
+    entt::registry registry;
+
+    counter on_construct{};
+    counter on_destroy{};
+    counter on_construct_range{};
+    counter on_destroy_range{};
+    std::size_t batches{};
+
+    pool.bind(entt::forward_as_any(registry));
+
+    pool.on_construct().connect<&listener<entt::registry>>(on_construct);
+    pool.on_destroy().connect<&listener<entt::registry>>(on_destroy);
+    pool.on_construct_range().connect<&range_listener<entt::registry>>(on_construct_range);
+    pool.on_destroy_range().connect<&range_listener<entt::registry>>(on_destroy_range);
+
+    pool.on_construct_range().connect<&batch_listener>(batches);
+    pool.on_destroy_range().connect<&batch_listener>(batches);
+
+    pool.insert(std::begin(entity), std::end(entity), 3);
+
+    ASSERT_EQ(batches, 1u);
+    ASSERT_EQ(on_construct.value, 3);
+    ASSERT_EQ(on_construct_range.value, 3);
+
+    base.erase(base.begin(), base.end());
+
+    ASSERT_EQ(batches, 2u);
+    ASSERT_EQ(on_destroy.value, 3);
+    ASSERT_EQ(on_destroy_range.value, 3);
+    ASSERT_TRUE(pool.empty());
+
+    pool.emplace(entity[0u]);
+
+    ASSERT_EQ(batches, 3u);
+    ASSERT_EQ(on_construct.value, 4);
+    ASSERT_EQ(on_construct_range.value, 4);
+
+    pool.insert(std::begin(entity) + 1u, std::end(entity));
+    pool.clear();
+
+    ASSERT_EQ(batches, 5u);
+    ASSERT_EQ(on_construct.value, 6);
+    ASSERT_EQ(on_construct_range.value, 6);
+    ASSERT_EQ(on_destroy.value, 6);
+    ASSERT_EQ(on_destroy_range.value, 6);
+    ASSERT_TRUE(pool.empty());
+
+    pool.on_construct_range().disconnect(&batches);
+    pool.on_destroy_range().disconnect(&batches);
+    pool.insert(std::begin(entity), std::end(entity));
+    pool.erase(entity[1u]);
+
+    ASSERT_EQ(batches, 5u);
+    ASSERT_EQ(on_construct_range.value, 9);
+    ASSERT_EQ(on_destroy_range.value, 7);
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_FALSE(pool.contains(entity[1u]));
+}
+
 TEST(SighMixin, Move) {
     entt::sigh_mixin<entt::storage<int>> pool;
     entt::registry registry;
@@ -521,6 +593,16 @@ TEST(SighMixin, StorageEntity) {
     ASSERT_EQ(pool.size(), 3u);
     ASSERT_EQ(pool.free_list(), 3u);
 
+    const auto other = pool.reserve_atomic();
+
+    ASSERT_EQ(on_construct.value, 6);
+    ASSERT_FALSE(pool.contains(other));
+    ASSERT_EQ(pool.commit_reserved(), 1u);
+    ASSERT_EQ(on_construct.value, 7);
+    ASSERT_TRUE(pool.contains(other));
+    ASSERT_EQ(pool.commit_reserved(), 0u);
+    ASSERT_EQ(on_construct.value, 7);
+
     pool.clear();
 
     ASSERT_EQ(pool.size(), 0u);
@@ -1,11 +1,15 @@
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/entity.hpp>
 #include <entt/entity/sparse_set.hpp>
 #include "../common/config.h"
+#include "../common/thread_executor.hpp"
 #include "../common/throwing_allocator.hpp"
 
 struct empty_type {};
@@ -14,6 +18,40 @@ struct boxed_int {
     int value;
 };
 
+enum class flat_entity : std::uint32_t {};
+
+struct flat_entity_traits {
+    using value_type = flat_entity;
+    using entity_type = std::uint32_t;
+    using version_type = std::uint16_t;
+    static constexpr entity_type entity_mask = 0xFFFF;
+    static constexpr entity_type version_mask = 0xFFFF;
+};
+
+template<>
+struct entt::entt_traits<flat_entity>: entt::basic_entt_traits<flat_entity_traits> {
+    using base_type = entt::basic_entt_traits<flat_entity_traits>;
+    static constexpr std::size_t page_size = 0u;
+};
+
+enum class tuned_entity : std::uint32_t {};
+
+struct tuned_entity_traits {
+    using value_type = tuned_entity;
+    using entity_type = std::uint32_t;
+    using version_type = std::uint16_t;
+    static constexpr entity_type entity_mask = 0xFFFFF;
+    static constexpr entity_type version_mask = 0xFFF;
+};
+
+template<>
+struct entt::entt_traits<tuned_entity>: entt::basic_entt_traits<tuned_entity_traits> {
+    using base_type = entt::basic_entt_traits<tuned_entity_traits>;
+    static constexpr std::size_t page_size = ENTT_SPARSE_PAGE;
+    static constexpr bool compressed_pages = true;
+    static constexpr bool presence_index = true;
+};
+
 TEST(SparseSet, Functionalities) {
     entt::sparse_set set;
 
@@ -128,6 +166,158 @@ TEST(SparseSet, Contains) {
     ASSERT_FALSE(set.contains(traits_type::construct(99, traits_type::to_version(entt::tombstone))));
 }
 
+TEST(SparseSet, ContainsRange) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::sparse_set set{entt::deletion_policy::in_place};
+    const entt::entity entity[5u]{entt::entity{0}, entt::entity{3}, entt::entity{42}, traits_type::construct(1, 5), entt::entity{traits_type::page_size + 1u}};
+    const entt::entity other[6u]{entt::null, entt::tombstone, entt::entity{1}, traits_type::construct(42, 1), entt::entity{4u * traits_type::page_size}, entt::entity{traits_type::page_size}};
+
+    ASSERT_EQ(set.contains(std::begin(entity), std::end(entity)), 0u);
+
+    set.push(std::begin(entity), std::end(entity));
+
+    ASSERT_EQ(set.contains(std::begin(entity), std::end(entity)), 0b11111u);
+    ASSERT_EQ(set.contains(std::begin(other), std::end(other)), 0u);
+    ASSERT_EQ(set.contains(std::begin(entity), std::begin(entity)), 0u);
+
+    const entt::entity mixed[4u]{entity[4u], other[2u], entity[0u], other[3u]};
+
+    ASSERT_EQ(set.contains(std::begin(mixed), std::end(mixed)), 0b0101u);
+
+    set.erase(entity[2u]);
+
+    ASSERT_EQ(set.contains(std::begin(entity), std::end(entity)), 0b11011u);
+    ASSERT_EQ(set.contains(set.begin(), set.end()), 0b11011u);
+
+    std::vector<entt::entity> block{};
+
+    for(std::size_t pos{}; pos < 64u; ++pos) {
+        block.push_back(entt::entity{static_cast<entt::id_type>(pos * 5u + 7u)});
+    }
+
+    set.push(block.begin() + 2u, block.end());
+
+    ASSERT_EQ(set.contains(block.begin(), block.end()), ~std::uint64_t{} ^ 0b11u);
+}
+
+TEST(SparseSet, PresenceIndex) {
+    using traits_type = entt::entt_traits<tuned_entity>;
+
+    entt::basic_sparse_set<tuned_entity> set{entt::deletion_policy::in_place};
+
+    set.push(tuned_entity{3});
+    set.push(tuned_entity{64});
+
+    ASSERT_FALSE(set.presence_index());
+    ASSERT_EQ(set.presence_extent(), 0u);
+    ASSERT_EQ(set.presence_word(0u), 0u);
+
+    set.presence_index(true);
+
+    ASSERT_TRUE(set.presence_index());
+    ASSERT_EQ(set.presence_extent(), 2u);
+    ASSERT_EQ(set.presence_word(0u), 0b1000u);
+    ASSERT_EQ(set.presence_word(1u), 0b1u);
+    ASSERT_EQ(set.presence_word(2u), 0u);
+    ASSERT_EQ(set.presence_summary(0u), 0b11u);
+    ASSERT_EQ(set.presence_summary(1u), 0u);
+
+    set.push(traits_type::construct(64u * 64u + 1u, 2u));
+
+    ASSERT_EQ(set.presence_extent(), 64u + 1u);
+    ASSERT_EQ(set.presence_word(64u), 0b10u);
+    ASSERT_EQ(set.presence_summary(1u), 0b1u);
+    ASSERT_TRUE(set.contains(traits_type::construct(64u * 64u + 1u, 2u)));
+    ASSERT_FALSE(set.contains(traits_type::construct(64u * 64u + 1u, 1u)));
+    ASSERT_FALSE(set.contains(tuned_entity{4}));
+    ASSERT_FALSE(set.contains(entt::tombstone));
+    ASSERT_FALSE(set.contains(entt::null));
+
+    set.erase(tuned_entity{64});
+
+    ASSERT_FALSE(set.contains(tuned_entity{64}));
+    ASSERT_EQ(set.presence_word(1u), 0u);
+    ASSERT_EQ(set.presence_summary(0u), 0b1u);
+
+    set.compact();
+    set.push(tuned_entity{64});
+
+    ASSERT_EQ(set.presence_word(1u), 0b1u);
+    ASSERT_EQ(set.presence_summary(0u), 0b11u);
+
+    entt::basic_sparse_set<tuned_entity> other{std::move(set)};
+
+    ASSERT_TRUE(other.presence_index());
+    ASSERT_TRUE(other.contains(tuned_entity{64}));
+
+    other.clear();
+
+    ASSERT_FALSE(other.contains(tuned_entity{3}));
+    ASSERT_EQ(other.presence_word(0u), 0u);
+    ASSERT_EQ(other.presence_summary(0u), 0u);
+
+    other.push(tuned_entity{5});
+    other.presence_index(false);
+
+    ASSERT_FALSE(other.presence_index());
+    ASSERT_EQ(other.presence_extent(), 0u);
+    ASSERT_TRUE(other.contains(tuned_entity{5}));
+}
+
+TEST(SparseSet, OptInFeatures) {
+    entt::sparse_set set{};
+
+    set.push(entt::entity{3});
+
+    ASSERT_FALSE(set.presence_index());
+    ASSERT_FALSE(set.compressed());
+    ASSERT_EQ(set.presence_extent(), 0u);
+    ASSERT_TRUE(set.contains(entt::entity{3}));
+}
+
+ENTT_DEBUG_TEST(SparseSetDeathTest, OptInFeatures) {
+    entt::sparse_set set{};
+
+    ASSERT_DEATH(set.presence_index(true), "");
+    ASSERT_DEATH(set.compressed(true), "");
+}
+
+TEST(SparseSet, Revision) {
+    entt::sparse_set set{};
+    auto revision = set.revision();
+
+    set.push(entt::entity{3});
+
+    ASSERT_NE(set.revision(), revision);
+
+    revision = set.revision();
+    set.sort([](auto lhs, auto rhs) { return lhs < rhs; });
+    ASSERT_TRUE(set.contains(entt::entity{3}));
+
+    ASSERT_EQ(set.revision(), revision);
+
+    set.erase(entt::entity{3});
+
+    ASSERT_NE(set.revision(), revision);
+
+    entt::sparse_set other{};
+    set.push(entt::entity{1});
+    revision = set.revision();
+    const auto next = other.revision();
+    set.swap(other);
+
+    ASSERT_NE(set.revision(), revision);
+    ASSERT_NE(set.revision(), next);
+    ASSERT_NE(other.revision(), revision);
+    ASSERT_NE(other.revision(), next);
+
+    revision = other.revision();
+    other.clear();
+
+    ASSERT_NE(other.revision(), revision);
+}
+
 TEST(SparseSet, Current) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -343,6 +533,163 @@ ENTT_DEBUG_TEST(SparseSetDeathTest, Push) {
     ASSERT_DEATH(set.push(std::begin(entity), std::end(entity)), "");
 }
 
+TEST(SparseSet, FlatSparseArray) {
+    using traits_type = entt::entt_traits<flat_entity>;
+
+    entt::basic_sparse_set<flat_entity> set{};
+    const flat_entity entity[3u]{flat_entity{3}, traits_type::construct(1024, 2), flat_entity{8}};
+
+    ASSERT_EQ(set.extent(), 0u);
+    ASSERT_FALSE(set.contains(flat_entity{3}));
+
+    set.push(std::begin(entity), std::end(entity));
+
+    ASSERT_EQ(set.extent(), 1025u);
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_TRUE(set.contains(entity[0u]));
+    ASSERT_TRUE(set.contains(entity[1u]));
+    ASSERT_FALSE(set.contains(traits_type::construct(1024, 1)));
+    ASSERT_FALSE(set.contains(flat_entity{4}));
+    ASSERT_FALSE(set.contains(flat_entity{2048}));
+    ASSERT_FALSE(set.contains(entt::tombstone));
+    ASSERT_FALSE(set.contains(entt::null));
+    ASSERT_EQ(set.current(entity[1u]), 2u);
+    ASSERT_EQ(set.index(entity[2u]), 2u);
+    ASSERT_EQ(set.contains(std::begin(entity), std::end(entity)), 0b111u);
+
+    set.erase(entity[0u]);
+
+    ASSERT_FALSE(set.contains(entity[0u]));
+    ASSERT_EQ(set.contains(std::begin(entity), std::end(entity)), 0b110u);
+    ASSERT_EQ(set.index(entity[2u]), 0u);
+    ASSERT_EQ(set.index(entity[1u]), 1u);
+
+    set.sort([](auto lhs, auto rhs) { return entt::to_integral(lhs) < entt::to_integral(rhs); });
+
+    ASSERT_EQ(set.index(entity[2u]), 1u);
+    ASSERT_EQ(set.index(entity[1u]), 0u);
+
+    entt::basic_sparse_set<flat_entity> other{std::move(set)};
+
+    ASSERT_TRUE(other.contains(entity[1u]));
+    ASSERT_EQ(other.extent(), 1025u);
+
+    other.clear();
+
+    ASSERT_FALSE(other.contains(entity[1u]));
+    ASSERT_EQ(other.extent(), 1025u);
+}
+
+TEST(SparseSet, CompressedPages) {
+    using traits_type = entt::entt_traits<tuned_entity>;
+
+    for(const auto policy: {entt::deletion_policy::swap_and_pop, entt::deletion_policy::in_place, entt::deletion_policy::swap_only}) {
+        entt::basic_sparse_set<tuned_entity> set{policy};
+        const tuned_entity entity[3u]{tuned_entity{3}, traits_type::construct(traits_type::page_size, 2), tuned_entity{8}};
+
+        set.push(std::begin(entity), std::end(entity));
+
+        ASSERT_FALSE(set.compressed());
+
+        set.compressed(true);
+
+        ASSERT_TRUE(set.compressed());
+        ASSERT_EQ(set.extent(), 2u * traits_type::page_size);
+        ASSERT_EQ(set.size(), 3u);
+        ASSERT_TRUE(set.contains(entity[0u]));
+        ASSERT_TRUE(set.contains(entity[1u]));
+        ASSERT_FALSE(set.contains(traits_type::construct(traits_type::page_size, 1)));
+        ASSERT_FALSE(set.contains(tuned_entity{4}));
+        ASSERT_FALSE(set.contains(tuned_entity{4u * traits_type::page_size}));
+        ASSERT_FALSE(set.contains(entt::tombstone));
+        ASSERT_FALSE(set.contains(entt::null));
+        ASSERT_EQ(set.current(entity[1u]), 2u);
+        ASSERT_EQ(set.current(tuned_entity{4}), traits_type::to_version(entt::tombstone));
+        ASSERT_EQ(set.contains(std::begin(entity), std::end(entity)), 0b111u);
+
+        set.erase(entity[0u]);
+
+        ASSERT_FALSE(set.contains(entity[0u]));
+        ASSERT_EQ(set.contains(std::begin(entity), std::end(entity)), 0b110u);
+        ASSERT_TRUE(set.contains(entity[1u]));
+        ASSERT_TRUE(set.contains(entity[2u]));
+
+        set.push(entity[0u]);
+
+        ASSERT_TRUE(set.contains(entity[0u]));
+
+        set.bump(traits_type::construct(8, 1));
+
+        ASSERT_FALSE(set.contains(entity[2u]));
+        ASSERT_TRUE(set.contains(traits_type::construct(8, 1)));
+        ASSERT_EQ(set.current(entity[2u]), 1u);
+
+        set.sort([](auto lhs, auto rhs) { return entt::to_integral(lhs) < entt::to_integral(rhs); });
+
+        for(auto it = set.begin(), last = set.end(); it != last; ++it) {
+            ASSERT_EQ(set.index(*it), static_cast<std::size_t>(it.index()));
+        }
+
+        set.compressed(false);
+
+        ASSERT_FALSE(set.compressed());
+        ASSERT_TRUE(set.contains(entity[0u]));
+        ASSERT_TRUE(set.contains(entity[1u]));
+        ASSERT_TRUE(set.contains(traits_type::construct(8, 1)));
+        ASSERT_EQ(set.current(entity[1u]), 2u);
+
+        set.compressed(true);
+        entt::basic_sparse_set<tuned_entity> other{std::move(set)};
+
+        ASSERT_TRUE(other.compressed());
+        ASSERT_TRUE(other.contains(entity[1u]));
+
+        other.clear();
+
+        ASSERT_FALSE(other.contains(entity[1u]));
+        ASSERT_TRUE(other.empty());
+    }
+}
+
+TEST(SparseSet, CompressedPagesFallback) {
+    constexpr auto length = static_cast<std::size_t>((std::numeric_limits<std::uint16_t>::max)());
+    entt::basic_sparse_set<tuned_entity> set{};
+
+    set.compressed(true);
+
+    for(std::size_t pos{}; pos < length - 1u; ++pos) {
+        set.push(tuned_entity{static_cast<std::uint32_t>(pos)});
+    }
+
+    ASSERT_TRUE(set.compressed());
+
+    set.push(tuned_entity{static_cast<std::uint32_t>(length - 1u)});
+
+    ASSERT_TRUE(set.compressed());
+
+    set.push(tuned_entity{static_cast<std::uint32_t>(length)});
+
+    ASSERT_FALSE(set.compressed());
+    ASSERT_EQ(set.size(), length + 1u);
+
+    for(std::size_t pos{}; pos <= length; ++pos) {
+        ASSERT_TRUE(set.contains(tuned_entity{static_cast<std::uint32_t>(pos)}));
+        ASSERT_EQ(set.index(tuned_entity{static_cast<std::uint32_t>(pos)}), pos);
+    }
+
+    set.compressed(true);
+
+    ASSERT_FALSE(set.compressed());
+
+    set.erase(tuned_entity{3});
+    set.erase(tuned_entity{4});
+    set.compressed(true);
+
+    ASSERT_TRUE(set.compressed());
+    ASSERT_FALSE(set.contains(tuned_entity{3}));
+    ASSERT_TRUE(set.contains(tuned_entity{static_cast<std::uint32_t>(length)}));
+}
+
 TEST(SparseSet, PushOutOfBounds) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -461,6 +808,53 @@ TEST(SparseSet, CrossErase) {
     ASSERT_EQ(set.data()[0u], entity[0u]);
 }
 
+TEST(SparseSet, BulkErase) {
+    entt::sparse_set set;
+    entt::sparse_set other;
+    std::vector<entt::entity> entity{};
+
+    for(std::uint32_t pos{}; pos < 64u; ++pos) {
+        entity.push_back(entt::entity{pos});
+    }
+
+    set.push(entity.begin(), entity.end());
+
+    for(std::size_t pos{}; pos < entity.size(); pos += 3u) {
+        other.push(entity[pos]);
+    }
+
+    set.erase(other.begin(), other.end());
+
+    ASSERT_EQ(set.size(), entity.size() - other.size());
+
+    for(std::size_t pos{}; pos < entity.size(); ++pos) {
+        ASSERT_EQ(set.contains(entity[pos]), (pos % 3u) != 0u);
+    }
+
+    for(std::size_t pos{}; pos < set.size(); ++pos) {
+        ASSERT_EQ(set.index(set.data()[pos]), pos);
+    }
+
+    const std::vector<entt::entity> doomed(set.begin(), set.end() - 2);
+    set.erase(doomed.begin(), doomed.end());
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_EQ(set.remove(entity.begin(), entity.end()), 2u);
+    ASSERT_TRUE(set.empty());
+
+    const std::vector<entt::entity> twice(entity.begin() + 4u, entity.begin() + 12u);
+    set.push(entity.begin(), entity.end());
+    entity.insert(entity.end(), twice.begin(), twice.end());
+
+    ASSERT_EQ(set.remove(entity.begin() + 4u, entity.end()), 60u);
+    ASSERT_EQ(set.size(), 4u);
+
+    for(std::size_t pos{}; pos < set.size(); ++pos) {
+        ASSERT_EQ(set.data()[pos], entity[pos]);
+        ASSERT_EQ(set.index(entity[pos]), pos);
+    }
+}
+
 TEST(SparseSet, StableErase) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -1075,6 +1469,179 @@ TEST(SparseSet, Compact) {
     ASSERT_TRUE(set.empty());
 }
 
+TEST(SparseSet, IncrementalCompact) {
+    entt::sparse_set set{entt::deletion_policy::in_place};
+    std::vector<entt::entity> entity{};
+
+    ASSERT_EQ(set.compact(4u), 0u);
+
+    for(std::uint32_t pos{}; pos < 16u; ++pos) {
+        entity.push_back(entt::entity{pos});
+    }
+
+    set.push(entity.begin(), entity.end());
+
+    for(std::size_t pos{}; pos < entity.size(); pos += 2u) {
+        set.erase(entity[pos]);
+    }
+
+    ASSERT_EQ(set.size(), 16u);
+    ASSERT_EQ(set.tombstones(), 8u);
+    ASSERT_EQ(set.compact(3u), 3u);
+    ASSERT_EQ(set.size(), 16u);
+    ASSERT_EQ(set.tombstones(), 8u);
+
+    set.push(entt::entity{42});
+    set.erase(entity[1u]);
+
+    ASSERT_EQ(set.tombstones(), 8u);
+
+    std::size_t steps{};
+
+    for(; set.tombstones() != 0u; ++steps) {
+        ASSERT_LE(set.compact(2u), 2u);
+    }
+
+    ASSERT_GT(steps, 1u);
+    ASSERT_EQ(set.size(), 8u);
+    ASSERT_TRUE(set.contains(entt::entity{42}));
+    ASSERT_EQ(set.compact(2u), 0u);
+
+    for(std::size_t pos{}; pos < set.size(); ++pos) {
+        ASSERT_NE(set.data()[pos], static_cast<entt::entity>(entt::tombstone));
+        ASSERT_EQ(set.index(set.data()[pos]), pos);
+    }
+
+    for(std::size_t pos{3u}; pos < entity.size(); pos += 2u) {
+        ASSERT_TRUE(set.contains(entity[pos]));
+    }
+}
+
+TEST(SparseSet, DisableEnable) {
+    entt::sparse_set set{};
+    std::vector<entt::entity> entity{};
+
+    for(std::uint32_t pos{}; pos < 32u; ++pos) {
+        entity.push_back(entt::entity{pos});
+    }
+
+    set.push(entity.begin(), entity.end());
+    set.disable(entity[3u]);
+    set.disable(entity[7u]);
+    set.disable(entity[3u]);
+
+    ASSERT_EQ(set.disabled(), 2u);
+    ASSERT_EQ(set.size(), 32u);
+    ASSERT_TRUE(set.contains(entity[3u]));
+    ASSERT_FALSE(set.enabled(entity[3u]));
+    ASSERT_FALSE(set.enabled(entity[7u]));
+    ASSERT_TRUE(set.enabled(entity[0u]));
+    ASSERT_FALSE(set.enabled(entt::entity{42}));
+    ASSERT_LT(set.index(entity[3u]), set.disabled());
+    ASSERT_LT(set.index(entity[7u]), set.disabled());
+
+    set.enable(entity[3u]);
+    set.enable(entity[0u]);
+
+    ASSERT_EQ(set.disabled(), 1u);
+    ASSERT_TRUE(set.enabled(entity[3u]));
+    ASSERT_EQ(set.index(entity[7u]), 0u);
+
+    set.disable(entity[1u]);
+    set.erase(entity[7u]);
+
+    ASSERT_EQ(set.disabled(), 1u);
+    ASSERT_EQ(set.index(entity[1u]), 0u);
+
+    set.disable(entity[5u]);
+
+    std::vector<entt::entity> other{entity.begin(), entity.begin() + 7u};
+    other.insert(other.end(), entity.begin() + 8u, entity.begin() + 21u);
+    set.erase(other.begin(), other.end());
+
+    ASSERT_EQ(set.disabled(), 0u);
+    ASSERT_EQ(set.size(), 11u);
+
+    set.disable(entity[21u]);
+    set.disable(entity[30u]);
+    set.sort(std::less{});
+
+    ASSERT_EQ(set.disabled(), 2u);
+    ASSERT_FALSE(set.enabled(entity[21u]));
+    ASSERT_FALSE(set.enabled(entity[30u]));
+    ASSERT_TRUE(std::is_sorted(set.begin(), set.end() - 2, std::less{}));
+
+    for(std::size_t pos{}; pos < set.size(); ++pos) {
+        ASSERT_EQ(set.index(set.data()[pos]), pos);
+    }
+
+    set.clear();
+
+    ASSERT_EQ(set.disabled(), 0u);
+}
+
+TEST(SparseSet, DisableEnableSwapOnly) {
+    entt::sparse_set set{entt::deletion_policy::swap_only};
+    const entt::entity entity[3u]{entt::entity{1}, entt::entity{3}, entt::entity{42}};
+
+    set.push(std::begin(entity), std::end(entity));
+    set.disable(entity[2u]);
+
+    ASSERT_EQ(set.free_list(), 3u);
+    ASSERT_EQ(set.index(entity[2u]), 0u);
+
+    set.erase(entity[2u]);
+
+    ASSERT_EQ(set.disabled(), 0u);
+    ASSERT_EQ(set.free_list(), 2u);
+    ASSERT_FALSE(set.contains(entity[2u]));
+    ASSERT_TRUE(set.enabled(entity[0u]));
+    ASSERT_TRUE(set.enabled(entity[1u]));
+}
+
+TEST(SparseSet, DisableEnableInPlace) {
+    entt::sparse_set set{entt::deletion_policy::in_place};
+    const entt::entity entity[3u]{entt::entity{3}, entt::entity{42}, entt::entity{99}};
+
+    set.push(std::begin(entity), std::end(entity));
+    set.disable(entity[1u]);
+    set.disable(entity[1u]);
+
+    ASSERT_EQ(set.disabled(), 1u);
+    ASSERT_EQ(set.disabled_prefix(), 0u);
+    ASSERT_EQ(set.index(entity[1u]), 1u);
+    ASSERT_TRUE(set.enabled(entity[0u]));
+    ASSERT_FALSE(set.enabled(entity[1u]));
+    ASSERT_TRUE(set.contains(entity[1u]));
+
+    set.enable(entity[1u]);
+
+    ASSERT_EQ(set.disabled(), 0u);
+    ASSERT_TRUE(set.enabled(entity[1u]));
+
+    set.disable(entity[2u]);
+    set.erase(entity[2u]);
+
+    ASSERT_EQ(set.disabled(), 0u);
+
+    set.push(entity[2u]);
+
+    ASSERT_TRUE(set.enabled(entity[2u]));
+
+    set.disable(entity[0u]);
+    set.clear();
+
+    ASSERT_EQ(set.disabled(), 0u);
+}
+
+ENTT_DEBUG_TEST(SparseSetDeathTest, DisableEnable) {
+    entt::sparse_set set{entt::deletion_policy::in_place};
+    set.push(entt::entity{42});
+
+    ASSERT_DEATH(set.disable(entt::entity{3}), "");
+    ASSERT_DEATH(set.enable(entt::entity{3}), "");
+}
+
 TEST(SparseSet, SwapEntity) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -1457,6 +2024,65 @@ TEST(SparseSet, SortRange) {
     ASSERT_EQ(begin, end);
 }
 
+TEST(SparseSet, SortParallel) {
+    for(const auto compressed: {false, true}) {
+        entt::basic_sparse_set<tuned_entity> set{entt::deletion_policy::in_place};
+        std::vector<tuned_entity> entity(20000u);
+
+        for(std::size_t pos{}; pos < entity.size(); ++pos) {
+            entity[pos] = tuned_entity{static_cast<std::uint32_t>((pos * 7919u) % entity.size())};
+        }
+
+        set.compressed(compressed);
+        set.push(entity.begin(), entity.end());
+        set.erase(entity[0u]);
+        set.sort(test::thread_executor{}, std::less{});
+
+        ASSERT_EQ(set.size(), entity.size() - 1u);
+        ASSERT_TRUE(std::is_sorted(set.begin(), set.end()));
+
+        for(std::size_t pos{}; pos < set.size(); ++pos) {
+            ASSERT_EQ(set.index(set[pos]), pos);
+        }
+
+        set.sort_n(test::thread_executor{}, 2u, std::greater{});
+
+        ASSERT_LT(set[0u], set[1u]);
+        ASSERT_EQ(set.index(set[0u]), 0u);
+        ASSERT_EQ(set.index(set[1u]), 1u);
+        ASSERT_TRUE(std::is_sorted(set.begin(), set.end() - 2u));
+    }
+}
+
+TEST(SparseSet, SortAsParallel) {
+    entt::sparse_set lhs;
+    entt::sparse_set rhs;
+    entt::sparse_set expected;
+
+    for(std::size_t pos{}; pos < 20000u; ++pos) {
+        const entt::entity entity{static_cast<entt::id_type>((pos * 7919u) % 20000u)};
+
+        lhs.push(entity);
+        expected.push(entity);
+
+        if(pos % 3u) {
+            rhs.push(entity);
+        }
+    }
+
+    rhs.push(entt::entity{20000u});
+    rhs.sort(std::less{});
+
+    lhs.sort_as(test::thread_executor{}, rhs);
+    expected.sort_as(rhs);
+
+    ASSERT_TRUE(std::equal(lhs.begin(), lhs.begin() + (rhs.size() - 1u), expected.begin()));
+
+    for(std::size_t pos{}; pos < lhs.size(); ++pos) {
+        ASSERT_EQ(lhs.index(lhs[pos]), pos);
+    }
+}
+
 ENTT_DEBUG_TEST(SparseSetDeathTest, SortRange) {
     entt::sparse_set set{entt::deletion_policy::in_place};
     entt::entity entity{42};
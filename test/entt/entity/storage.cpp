@@ -1,15 +1,19 @@
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <memory>
 #include <tuple>
 #include <type_traits>
 #include <unordered_set>
+#include <string>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/component.hpp>
 #include <entt/entity/storage.hpp>
 #include "../common/config.h"
+#include "../common/thread_executor.hpp"
 #include "../common/throwing_allocator.hpp"
 #include "../common/throwing_type.hpp"
 #include "../common/tracked_memory_resource.hpp"
@@ -86,6 +90,48 @@ struct create_from_constructor {
     entt::entity child;
 };
 
+struct contiguous_type {
+    static constexpr auto contiguous = true;
+    int value;
+};
+
+struct contiguous_boxed_type {
+    static constexpr auto contiguous = true;
+    std::unique_ptr<int> value;
+};
+
+struct contiguous_string_type {
+    static constexpr auto contiguous = true;
+
+    contiguous_string_type(std::string elem = {})
+        : value{std::move(elem)} {}
+
+    std::string value;
+};
+
+struct soa_type {
+    int value;
+    char other;
+
+    using soa_members = entt::value_list<&soa_type::value, &soa_type::other>;
+};
+
+struct unordered_soa_type {
+    int value;
+    int other;
+    int ignored;
+
+    using soa_members = entt::value_list<&unordered_soa_type::other, &unordered_soa_type::value>;
+};
+
+struct stable_soa_type {
+    static constexpr auto in_place_delete = true;
+
+    int value;
+
+    using soa_members = entt::value_list<&stable_soa_type::value>;
+};
+
 template<>
 struct entt::component_traits<std::unordered_set<char>> {
     static constexpr auto in_place_delete = true;
@@ -465,6 +511,34 @@ TEST_F(Storage, CrossErase) {
     ASSERT_EQ(pool.raw()[0u][0u], 3);
 }
 
+TEST_F(Storage, BulkErase) {
+    entt::sparse_set set;
+    entt::storage<int> pool;
+    std::vector<entt::entity> entity{};
+
+    for(std::uint32_t pos{}; pos < 64u; ++pos) {
+        entity.push_back(entt::entity{pos});
+        pool.emplace(entity.back(), static_cast<int>(pos));
+    }
+
+    for(std::size_t pos{}; pos < entity.size(); pos += 2u) {
+        set.push(entity[pos]);
+    }
+
+    ASSERT_EQ(pool.remove(set.begin(), set.end()), set.size());
+    ASSERT_EQ(pool.size(), entity.size() - set.size());
+
+    for(auto [entt, value]: pool.each()) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), value);
+        ASSERT_EQ(entt::to_integral(entt) % 2u, 1u);
+    }
+
+    const entt::sparse_set &base = pool;
+    pool.erase(base.begin(), base.end());
+
+    ASSERT_TRUE(pool.empty());
+}
+
 TEST_F(Storage, StableErase) {
     entt::storage<stable_type> pool;
     entt::entity entity[3u]{entt::entity{3}, entt::entity{42}, entt::entity{9}};
@@ -944,6 +1018,68 @@ TEST_F(Storage, Compact) {
     ASSERT_TRUE(pool.empty());
 }
 
+TEST_F(Storage, IncrementalCompact) {
+    entt::storage<stable_type> pool;
+
+    for(std::uint32_t pos{}; pos < 8u; ++pos) {
+        pool.emplace(entt::entity{pos}, stable_type{static_cast<int>(pos)});
+    }
+
+    pool.erase(entt::entity{0});
+    pool.erase(entt::entity{2});
+    pool.erase(entt::entity{5});
+
+    ASSERT_EQ(pool.tombstones(), 3u);
+    ASSERT_EQ(pool.compact(1u), 1u);
+    ASSERT_EQ(pool.compact(1u), 1u);
+    ASSERT_EQ(pool.size(), 8u);
+
+    pool.emplace(entt::entity{0}, stable_type{0});
+
+    while(pool.tombstones() != 0u) {
+        pool.compact(1u);
+    }
+
+    ASSERT_EQ(pool.size(), 6u);
+
+    for(auto [entt, elem]: pool.each()) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), elem.value);
+    }
+}
+
+TEST_F(Storage, DisableEnable) {
+    entt::storage<int> pool;
+    std::vector<entt::entity> entity{};
+
+    for(std::uint32_t pos{}; pos < 32u; ++pos) {
+        entity.push_back(entt::entity{pos});
+        pool.emplace(entity.back(), static_cast<int>(pos));
+    }
+
+    pool.disable(entity[4u]);
+    pool.disable(entity[9u]);
+    pool.disable(entity[17u]);
+
+    ASSERT_EQ(pool.disabled(), 3u);
+    ASSERT_EQ(pool.get(entity[9u]), 9);
+
+    pool.erase(entity[9u]);
+    pool.erase(entity.begin() + 10u, entity.end());
+
+    ASSERT_EQ(pool.disabled(), 1u);
+    ASSERT_EQ(pool.size(), 9u);
+    ASSERT_FALSE(pool.enabled(entity[4u]));
+
+    for(auto [entt, value]: pool.each()) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), value);
+    }
+
+    pool.enable(entity[4u]);
+
+    ASSERT_EQ(pool.disabled(), 0u);
+    ASSERT_EQ(pool.get(entity[4u]), 4);
+}
+
 TEST_F(Storage, ShrinkToFit) {
     entt::storage<int> pool;
     constexpr auto page_size = decltype(pool)::traits_type::page_size;
@@ -1705,6 +1841,100 @@ TEST_F(Storage, Raw) {
     ASSERT_EQ(pool.raw()[0u][2u], 9);
 }
 
+TEST_F(Storage, Contiguous) {
+    entt::storage<contiguous_type> pool;
+    constexpr auto page_size = decltype(pool)::traits_type::page_size;
+    constexpr auto length = page_size * 3u;
+
+    ASSERT_TRUE(decltype(pool)::traits_type::contiguous);
+    ASSERT_EQ(std::as_const(pool).values(), nullptr);
+    ASSERT_EQ(pool.capacity(), 0u);
+
+    for(std::size_t pos{}; pos < length; ++pos) {
+        pool.emplace(static_cast<entt::entity>(pos), static_cast<int>(pos));
+    }
+
+    ASSERT_EQ(pool.raw()[0u], pool.values());
+    ASSERT_GE(pool.capacity(), length);
+
+    for(std::size_t pos{}; pos < length; ++pos) {
+        ASSERT_EQ(&pool.values()[pos], &pool.get(static_cast<entt::entity>(pos)));
+        ASSERT_EQ(pool.values()[pos].value, static_cast<int>(pos));
+    }
+
+    ASSERT_EQ(std::distance(pool.begin(), pool.end()), static_cast<std::ptrdiff_t>(length));
+    ASSERT_EQ(&*pool.begin(), &pool.values()[length - 1u]);
+
+    pool.erase(entt::entity{0});
+
+    ASSERT_EQ(pool.values()[0u].value, static_cast<int>(length - 1u));
+
+    pool.sort([](auto lhs, auto rhs) { return lhs < rhs; });
+
+    for(std::size_t pos{}, last = pool.size(); pos < last; ++pos) {
+        ASSERT_EQ(pool.values()[pos].value, static_cast<int>(last - pos));
+    }
+
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.capacity(), pool.size());
+    ASSERT_EQ(pool.values()[0u].value, static_cast<int>(length - 1u));
+
+    pool.clear();
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.capacity(), 0u);
+    ASSERT_EQ(pool.values(), nullptr);
+
+    pool.reserve(length);
+
+    ASSERT_EQ(pool.capacity(), length);
+}
+
+TEST_F(Storage, ContiguousRelocation) {
+    entt::storage<contiguous_boxed_type> pool;
+    entt::storage<contiguous_boxed_type> other;
+
+    for(std::size_t pos{}; pos < 100u; ++pos) {
+        pool.emplace(static_cast<entt::entity>(pos), std::make_unique<int>(static_cast<int>(pos)));
+    }
+
+    pool.erase(entt::entity{4});
+    pool.shrink_to_fit();
+    other = std::move(pool);
+
+    ASSERT_EQ(other.capacity(), 99u);
+    ASSERT_EQ(*other.get(entt::entity{3}).value, 3);
+    ASSERT_EQ(*other.get(entt::entity{99}).value, 99);
+    ASSERT_EQ(&other.get(entt::entity{99}), other.values() + 4u);
+}
+
+TEST_F(Storage, ContiguousSelfReference) {
+    entt::storage<contiguous_string_type> pool;
+    const std::string expected(100u, 'x');
+
+    pool.emplace(entt::entity{0}, expected);
+
+    for(std::size_t pos = 1u; pos < 10u; ++pos) {
+        pool.emplace(static_cast<entt::entity>(pos), pool.get(entt::entity{0}));
+    }
+
+    for(std::size_t pos{}; pos < 10u; ++pos) {
+        ASSERT_EQ(pool.get(static_cast<entt::entity>(pos)).value, expected);
+    }
+
+    pool.shrink_to_fit();
+
+    const entt::entity entity[3u]{entt::entity{10}, entt::entity{11}, entt::entity{12}};
+    pool.insert(std::begin(entity), std::end(entity), pool.get(entt::entity{0}));
+
+    ASSERT_GT(pool.capacity(), 10u);
+
+    for(std::size_t pos{}; pos < 13u; ++pos) {
+        ASSERT_EQ(pool.get(static_cast<entt::entity>(pos)).value, expected);
+    }
+}
+
 TEST_F(Storage, SwapElements) {
     entt::storage<int> pool;
 
@@ -1773,6 +2003,24 @@ TEST_F(Storage, SortReverse) {
     ASSERT_TRUE(std::equal(std::begin(values), std::end(values), pool.begin(), pool.end()));
 }
 
+TEST_F(Storage, SortParallel) {
+    entt::storage<boxed_int> pool;
+
+    for(std::size_t pos{}; pos < 20000u; ++pos) {
+        const auto value = static_cast<int>((pos * 7919u) % 20000u);
+        pool.emplace(entt::entity{static_cast<entt::id_type>(pos)}, value);
+    }
+
+    pool.sort(test::thread_executor{}, [&pool](auto lhs, auto rhs) { return pool.get(lhs).value < pool.get(rhs).value; });
+
+    ASSERT_TRUE(std::is_sorted(pool.begin(), pool.end(), [](const auto &lhs, const auto &rhs) { return lhs.value < rhs.value; }));
+
+    for(std::size_t pos{}; pos < 20000u; ++pos) {
+        const entt::entity entity{static_cast<entt::id_type>(pos)};
+        ASSERT_EQ(pool.get(entity).value, static_cast<int>((pos * 7919u) % 20000u));
+    }
+}
+
 TEST_F(Storage, SortUnordered) {
     entt::storage<boxed_int> pool;
     entt::entity entity[5u]{entt::entity{12}, entt::entity{42}, entt::entity{7}, entt::entity{3}, entt::entity{9}};
@@ -2303,6 +2551,118 @@ TEST_F(Storage, UsesAllocatorConstruction) {
 
 #endif
 
+TEST_F(Storage, StructureOfArrays) {
+    entt::storage<soa_type> pool;
+    const entt::entity entity[3u]{entt::entity{1}, entt::entity{3}, entt::entity{42}};
+
+    testing::StaticAssertTypeEq<decltype(pool.get({})), std::tuple<int &, char &>>();
+    testing::StaticAssertTypeEq<decltype(std::as_const(pool).get({})), std::tuple<const int &, const char &>>();
+    testing::StaticAssertTypeEq<decltype(*pool.each().begin()), std::tuple<entt::entity, int &, char &>>();
+
+    pool.emplace(entity[0u], 1, 'a');
+    pool.emplace(entity[1u], 2, 'b');
+    pool.emplace(entity[2u], 3, 'c');
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.value(entity[0u]), nullptr);
+    ASSERT_EQ(pool.get(entity[1u]), std::make_tuple(2, 'b'));
+
+    auto [value, other] = pool.get(entity[1u]);
+    value = 4;
+    other = 'd';
+
+    ASSERT_EQ(std::as_const(pool).get_as_tuple(entity[1u]), std::make_tuple(4, 'd'));
+
+    const auto *page = pool.raw<&soa_type::value>()[0u];
+
+    ASSERT_EQ(page[0u], 1);
+    ASSERT_EQ(page[1u], 4);
+    ASSERT_EQ(page[2u], 3);
+
+    for(auto [entt, curr, chr]: pool.each()) {
+        ASSERT_EQ(pool.get(entt), std::make_tuple(curr, chr));
+        ASSERT_EQ(&std::get<0u>(pool.get(entt)), &curr);
+    }
+
+    std::size_t count{};
+
+    for(auto &curr: pool.member<&soa_type::other>()) {
+        ASSERT_EQ(curr, std::get<1u>(pool.begin()[count++]));
+    }
+
+    ASSERT_EQ(count, pool.size());
+    ASSERT_EQ(std::get<0>(*pool.begin()), 3);
+
+    pool.patch(entity[0u], [](auto &elem) { elem.value = 5; });
+
+    ASSERT_EQ(pool.get(entity[0u]), std::make_tuple(5, 'a'));
+
+    pool.erase(entity[0u]);
+
+    ASSERT_FALSE(pool.contains(entity[0u]));
+    ASSERT_EQ(pool.index(entity[2u]), 0u);
+    ASSERT_EQ(pool.get(entity[2u]), std::make_tuple(3, 'c'));
+
+    pool.sort([](auto lhs, auto rhs) { return lhs > rhs; });
+
+    ASSERT_EQ(pool.get(entity[1u]), std::make_tuple(4, 'd'));
+    ASSERT_EQ(pool.get(entity[2u]), std::make_tuple(3, 'c'));
+    ASSERT_EQ(std::get<1u>(*pool.reach().begin()), 4);
+
+    pool.clear();
+    pool.shrink_to_fit();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.capacity(), 0u);
+}
+
+TEST_F(Storage, StructureOfArraysPatch) {
+    entt::storage<unordered_soa_type> pool;
+    const entt::entity entity{42};
+
+    pool.emplace(entity, 1, 2, 3);
+
+    ASSERT_EQ(pool.get(entity), std::make_tuple(2, 1));
+
+    pool.patch(entity);
+
+    ASSERT_EQ(pool.get(entity), std::make_tuple(2, 1));
+
+    pool.patch(entity, [](auto &elem) {
+        ASSERT_EQ(elem.value, 1);
+        ASSERT_EQ(elem.other, 2);
+        ASSERT_EQ(elem.ignored, 0);
+
+        elem.value = 4;
+        elem.ignored = 5;
+    });
+
+    ASSERT_EQ(pool.get(entity), std::make_tuple(2, 4));
+}
+
+TEST_F(Storage, StructureOfArraysInPlaceDelete) {
+    entt::storage<stable_soa_type> pool;
+    const entt::entity entity[2u]{entt::entity{1}, entt::entity{3}};
+    const stable_soa_type value{2};
+
+    pool.emplace(entity[0u], 1);
+    pool.push(entity[1u], &value);
+
+    ASSERT_EQ(pool.policy(), entt::deletion_policy::in_place);
+    ASSERT_EQ(std::get<0>(pool.get(entity[1u])), 2);
+
+    pool.erase(entity[0u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.index(entity[1u]), 1u);
+
+    pool.compact();
+
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_EQ(pool.index(entity[1u]), 0u);
+    ASSERT_EQ(std::get<0>(pool.get(entity[1u])), 2);
+}
+
 TEST_F(Storage, StorageType) {
     // just a bunch of static asserts to avoid regressions
     testing::StaticAssertTypeEq<entt::storage_type_t<char, entt::entity>, entt::sigh_mixin<entt::basic_storage<char, entt::entity>>>();
@@ -1,8 +1,10 @@
 #include <algorithm>
 #include <iterator>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/storage.hpp>
 #include "../common/config.h"
@@ -276,6 +278,86 @@ TEST(StorageEntity, Insert) {
     ASSERT_EQ(pool.in_use(), 1u);
 }
 
+TEST(StorageEntity, ReserveAtomic) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::storage<entt::entity> pool;
+    entt::entity entity[2u]{};
+
+    pool.insert(std::begin(entity), std::end(entity));
+    pool.erase(entity[0u]);
+
+    ASSERT_EQ(pool.reserved(), 0u);
+
+    const auto recycled = pool.reserve_atomic();
+    pool.reserve_atomic(std::begin(entity), std::end(entity));
+
+    ASSERT_EQ(pool.reserved(), 3u);
+    ASSERT_EQ(recycled, traits_type::construct(0, 1));
+    ASSERT_EQ(entity[0u], entt::entity{2});
+    ASSERT_EQ(entity[1u], entt::entity{3});
+
+    // recycled identifiers are contained but not in use until committed
+    ASSERT_FALSE(pool.index(recycled) < pool.free_list());
+    ASSERT_FALSE(pool.contains(entity[0u]));
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.free_list(), 1u);
+
+    entt::storage<entt::entity> other{std::move(pool)};
+
+    ASSERT_EQ(pool.reserved(), 0u);
+    ASSERT_EQ(other.reserved(), 3u);
+
+    pool.swap(other);
+
+    ASSERT_EQ(pool.reserved(), 3u);
+    ASSERT_EQ(other.reserved(), 0u);
+
+    other.swap(pool);
+
+    ASSERT_EQ(pool.reserved(), 0u);
+    ASSERT_EQ(other.reserved(), 3u);
+    ASSERT_EQ(other.commit_reserved(), 3u);
+    ASSERT_EQ(other.reserved(), 0u);
+
+    ASSERT_TRUE(other.index(recycled) < other.free_list());
+    ASSERT_TRUE(other.contains(entity[0u]));
+    ASSERT_TRUE(other.contains(entity[1u]));
+    ASSERT_EQ(other.size(), 4u);
+    ASSERT_EQ(other.free_list(), 4u);
+    ASSERT_EQ(other.emplace(), entt::entity{4});
+}
+
+TEST(StorageEntity, ReserveAtomicConcurrent) {
+    entt::storage<entt::entity> pool;
+    std::vector<entt::entity> entity(4096u);
+    std::vector<std::thread> workers{};
+
+    pool.insert(entity.begin(), entity.begin() + 512u);
+    pool.erase(entity.begin(), entity.begin() + 256u);
+
+    for(std::size_t next{}; next < 4u; ++next) {
+        workers.emplace_back([&pool, &entity, next]() {
+            for(auto pos = next; pos < entity.size(); pos += 4u) {
+                entity[pos] = pool.reserve_atomic();
+            }
+        });
+    }
+
+    for(auto &&elem: workers) {
+        elem.join();
+    }
+
+    ASSERT_EQ(pool.reserved(), entity.size());
+    ASSERT_EQ(pool.commit_reserved(), entity.size());
+    ASSERT_EQ(pool.free_list(), entity.size() + 256u);
+
+    std::sort(entity.begin(), entity.end());
+
+    ASSERT_EQ(std::adjacent_find(entity.begin(), entity.end()), entity.end());
+    ASSERT_TRUE(std::all_of(entity.begin(), entity.end(), [&pool](const auto entt) { return pool.contains(entt) && (pool.index(entt) < pool.free_list()); }));
+}
+
 TEST(StorageEntity, Pack) {
     entt::storage<entt::entity> pool;
     entt::entity entity[3u]{entt::entity{1}, entt::entity{3}, entt::entity{42}};
@@ -1,10 +1,15 @@
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <tuple>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/view.hpp>
+#include "../common/thread_executor.hpp"
 
 struct empty_type {};
 
@@ -13,6 +18,23 @@ struct stable_type {
     int value;
 };
 
+enum class indexed_entity : std::uint32_t {};
+
+struct indexed_entity_traits {
+    using value_type = indexed_entity;
+    using entity_type = std::uint32_t;
+    using version_type = std::uint16_t;
+    static constexpr entity_type entity_mask = 0xFFFFF;
+    static constexpr entity_type version_mask = 0xFFF;
+};
+
+template<>
+struct entt::entt_traits<indexed_entity>: entt::basic_entt_traits<indexed_entity_traits> {
+    using base_type = entt::basic_entt_traits<indexed_entity_traits>;
+    static constexpr std::size_t page_size = ENTT_SPARSE_PAGE;
+    static constexpr bool presence_index = true;
+};
+
 TEST(SingleComponentView, Functionalities) {
     entt::registry registry;
     auto view = registry.view<char>();
@@ -254,6 +276,74 @@ TEST(SingleComponentView, Each) {
     }
 }
 
+TEST(SingleComponentView, ParallelEach) {
+    entt::registry registry;
+    auto view = registry.view<int>();
+    std::atomic<std::size_t> count{};
+
+    view.each(test::thread_executor{}, [&count](int &) { ++count; });
+
+    ASSERT_EQ(count, 0u);
+
+    for(int pos{}; pos < 3000; ++pos) {
+        registry.emplace<int>(registry.create(), pos);
+    }
+
+    const auto disabled = view.front();
+    registry.disable(disabled);
+
+    view.each(test::thread_executor{}, [&count](const entt::entity entt, int &value) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), value);
+        value *= 2;
+        ++count;
+    });
+
+    ASSERT_EQ(count, 2999u);
+
+    view.each(test::thread_executor{}, [](int &value) { ++value; });
+
+    for(auto [entt, value]: view.each()) {
+        ASSERT_EQ(value, static_cast<int>(entt::to_integral(entt)) * 2 + 1);
+    }
+
+    ASSERT_EQ(registry.get<int>(disabled), static_cast<int>(entt::to_integral(disabled)));
+}
+
+TEST(SingleComponentView, EachIf) {
+    entt::registry registry;
+    auto view = registry.view<int>();
+
+    view.each_if([](const int) { return true; }, [](auto &&...) { FAIL(); });
+
+    for(int pos{}; pos < 300; ++pos) {
+        registry.emplace<int>(registry.create(), pos);
+    }
+
+    const auto disabled = view.back();
+    registry.disable(disabled);
+
+    std::size_t count{};
+
+    view.each_if([](const int value) { return value % 4 == 0; }, [&count](const entt::entity entt, int &value) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), value);
+        ASSERT_EQ(value % 4, 0);
+        ++value;
+        ++count;
+    });
+
+    ASSERT_EQ(count, 74u);
+    ASSERT_EQ(registry.get<int>(disabled), 0);
+
+    count = 0u;
+    view.each_if([](const int value) { return value % 4 == 2; }, [&registry, &count](const entt::entity entt, int &) {
+        registry.erase<int>(entt);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 75u);
+    ASSERT_EQ(view.size(), 224u);
+}
+
 TEST(SingleComponentView, ConstNonConstAndAllInBetween) {
     entt::registry registry;
     auto view = registry.view<int>();
@@ -599,6 +689,47 @@ TEST(SingleComponentView, StorageEntity) {
     });
 }
 
+TEST(SingleComponentView, DisabledEntities) {
+    entt::storage<int> storage{};
+    entt::basic_view view{storage};
+    const entt::entity entity[3u]{entt::entity{1}, entt::entity{3}, entt::entity{42}};
+
+    storage.emplace(entity[0u], 0);
+    storage.emplace(entity[1u], 1);
+    storage.emplace(entity[2u], 2);
+    storage.disable(entity[1u]);
+
+    ASSERT_EQ(view.size(), 2u);
+    ASSERT_FALSE(view.empty());
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 2);
+    ASSERT_EQ(std::distance(view.rbegin(), view.rend()), 2);
+    ASSERT_FALSE(view.contains(entity[1u]));
+    ASSERT_EQ(view.find(entity[1u]), view.end());
+    ASSERT_NE(view.find(entity[0u]), view.end());
+    ASSERT_NE(view.front(), entity[1u]);
+    ASSERT_NE(view.back(), entity[1u]);
+
+    for(auto [entt, value]: view.each()) {
+        ASSERT_NE(entt, entity[1u]);
+        ASSERT_NE(value, 1);
+    }
+
+    view.each([&entity](const auto entt, auto &) { ASSERT_NE(entt, entity[1u]); });
+    view.each([](const auto value) { ASSERT_NE(value, 1); });
+
+    storage.disable(entity[0u]);
+    storage.disable(entity[2u]);
+
+    ASSERT_TRUE(view.empty());
+    ASSERT_EQ(view.begin(), view.end());
+    ASSERT_EQ(view.front(), static_cast<entt::entity>(entt::null));
+
+    storage.enable(entity[1u]);
+
+    ASSERT_EQ(view.size(), 1u);
+    ASSERT_EQ(view.front(), entity[1u]);
+}
+
 TEST(MultiComponentView, Functionalities) {
     entt::registry registry;
     auto view = registry.view<int, char>();
@@ -797,6 +928,46 @@ TEST(MultiComponentView, Iterator) {
     ASSERT_EQ(++begin, view.end());
 }
 
+TEST(MultiComponentView, IteratorWithHoles) {
+    entt::registry registry;
+    std::vector<entt::entity> expected{};
+
+    for(std::size_t pos{}; pos < 100u; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity);
+
+        if(pos % 3u) {
+            registry.emplace<char>(entity);
+        }
+
+        if(pos % 7u == 0u) {
+            registry.emplace<double>(entity);
+        }
+
+        if((pos % 3u) && (pos % 7u)) {
+            expected.push_back(entity);
+        }
+    }
+
+    const auto view = registry.view<int, char>(entt::exclude<double>);
+    std::vector<entt::entity> visited{};
+
+    for(auto entity: view) {
+        visited.push_back(entity);
+    }
+
+    std::reverse(expected.begin(), expected.end());
+
+    ASSERT_EQ(visited, expected);
+    ASSERT_EQ(std::distance(view.begin(), view.end()), static_cast<std::ptrdiff_t>(expected.size()));
+    ASSERT_EQ(*view.find(expected[20u]), expected[20u]);
+    ASSERT_EQ(*++view.find(expected[20u]), expected[21u]);
+
+    registry.remove<char>(expected.begin(), expected.end());
+
+    ASSERT_EQ(view.begin(), view.end());
+}
+
 TEST(MultiComponentView, ElementAccess) {
     entt::registry registry;
     auto view = registry.view<int, char>();
@@ -932,6 +1103,42 @@ TEST(MultiComponentView, Each) {
     }
 }
 
+TEST(MultiComponentView, ParallelEach) {
+    entt::registry registry;
+    auto view = registry.view<int, char>(entt::exclude<double>);
+    std::atomic<std::size_t> count{};
+
+    for(int pos{}; pos < 3000; ++pos) {
+        const auto entt = registry.create();
+        registry.emplace<int>(entt, pos);
+
+        if(pos % 3 != 0) {
+            registry.emplace<char>(entt);
+        }
+
+        if(pos % 5 == 0) {
+            registry.emplace<double>(entt);
+        }
+    }
+
+    view.each(test::thread_executor{}, [&count](const entt::entity entt, int &value, char &) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), value);
+        value *= 2;
+        ++count;
+    });
+
+    ASSERT_EQ(count, 1600u);
+
+    std::as_const(registry).view<const int, const char>().each(test::thread_executor{2u}, [&count](const int &, const char &) { ++count; });
+
+    ASSERT_EQ(count, 3600u);
+
+    for(auto [entt, value]: registry.view<int>().each()) {
+        const auto pos = static_cast<int>(entt::to_integral(entt));
+        ASSERT_EQ(value, (pos % 3 != 0 && pos % 5 != 0) ? (pos * 2) : pos);
+    }
+}
+
 TEST(MultiComponentView, EachWithSuggestedType) {
     entt::registry registry;
     auto view = registry.view<int, char>();
@@ -1010,6 +1217,234 @@ TEST(MultiComponentView, EachWithHoles) {
     }
 }
 
+TEST(MultiComponentView, EachWithPresenceIndex) {
+    entt::basic_registry<indexed_entity> registry;
+    std::vector<indexed_entity> expected{};
+
+    for(std::size_t pos{}; pos < 1000u; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, static_cast<int>(pos));
+
+        if(pos % 3u == 0u) {
+            registry.emplace<char>(entity);
+        }
+
+        if(pos % 5u == 0u) {
+            registry.emplace<double>(entity);
+        }
+
+        if((pos % 15u == 0u) && (pos % 2u)) {
+            expected.push_back(entity);
+        }
+
+        if(pos % 2u == 0u) {
+            registry.emplace<float>(entity);
+        }
+    }
+
+    registry.storage<char>().presence_index(true);
+    registry.storage<double>().presence_index(true);
+
+    auto view = registry.view<int, char, double>(entt::exclude<float>);
+    std::vector<indexed_entity> visited{};
+
+    view.use<int>();
+    view.each([&visited](const auto entity, const int value, const char, const double) {
+        ASSERT_EQ(static_cast<int>(entt::to_entity(entity)), value);
+        visited.push_back(entity);
+    });
+
+    std::reverse(expected.begin(), expected.end());
+
+    ASSERT_EQ(visited, expected);
+
+    registry.destroy(expected.back());
+    registry.emplace<float>(expected.front());
+    visited.clear();
+
+    view.each([&visited](const auto entity, auto &&...) {
+        visited.push_back(entity);
+    });
+
+    ASSERT_EQ(visited, (std::vector<indexed_entity>{expected.begin() + 1u, expected.end() - 1u}));
+}
+
+TEST(MultiComponentView, ExclusionCacheVersions) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::storage<int> storage{};
+    entt::storage<char> other{};
+    entt::storage<double> excluded{};
+    entt::basic_view view{std::forward_as_tuple(storage, other), std::forward_as_tuple(excluded)};
+    const entt::entity entity[2u]{traits_type::construct(1, 0), traits_type::construct(3, 0)};
+
+    for(auto entt: entity) {
+        storage.emplace(entt);
+        other.emplace(entt);
+    }
+
+    excluded.emplace(traits_type::construct(1, 1));
+    excluded.emplace(entity[1u]);
+
+    view.exclusion_cache(true);
+
+    ASSERT_TRUE(view.exclusion_cache());
+
+    std::vector<entt::entity> visited{};
+    view.each([&visited](const auto entt, auto &&...) { visited.push_back(entt); });
+
+    ASSERT_EQ(visited, (std::vector<entt::entity>{entity[0u]}));
+}
+
+TEST(MultiComponentView, EachWithSparsePresenceIndex) {
+    entt::basic_storage<int, indexed_entity> storage{};
+    entt::basic_storage<char, indexed_entity> other{};
+    entt::basic_view view{storage, other};
+    const indexed_entity entity[3u]{indexed_entity{1}, indexed_entity{3}, indexed_entity{65536}};
+
+    storage.emplace(entity[0u]);
+    storage.emplace(entity[2u]);
+
+    for(auto entt: entity) {
+        other.emplace(entt);
+    }
+
+    other.presence_index(true);
+    view.use<int>();
+
+    std::vector<indexed_entity> visited{};
+    view.each([&visited](const auto entt, auto &&...) { visited.push_back(entt); });
+
+    ASSERT_EQ(visited, (std::vector<indexed_entity>{entity[2u], entity[0u]}));
+}
+
+TEST(MultiComponentView, EachWithExclusionCache) {
+    entt::basic_registry<indexed_entity> registry;
+    std::vector<indexed_entity> expected{};
+
+    for(std::size_t pos{}; pos < 1000u; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, static_cast<int>(pos));
+        registry.emplace<double>(entity);
+
+        if(pos % 3u == 0u) {
+            registry.emplace<char>(entity);
+        }
+
+        if(pos % 5u == 0u) {
+            registry.emplace<float>(entity);
+        }
+
+        if((pos % 3u != 0u) && (pos % 5u != 0u)) {
+            expected.push_back(entity);
+        }
+    }
+
+    registry.storage<float>().presence_index(true);
+
+    auto view = registry.view<int, double>(entt::exclude<char, float>);
+    std::vector<indexed_entity> visited{};
+
+    ASSERT_FALSE(view.exclusion_cache());
+
+    view.exclusion_cache(true);
+
+    ASSERT_TRUE(view.exclusion_cache());
+    ASSERT_TRUE(decltype(view){view}.exclusion_cache());
+
+    view.use<int>();
+    view.each([&visited](const auto entity, const int value, const double) {
+        ASSERT_EQ(static_cast<int>(entt::to_entity(entity)), value);
+        visited.push_back(entity);
+    });
+
+    std::reverse(expected.begin(), expected.end());
+
+    ASSERT_EQ(visited, expected);
+
+    std::atomic<std::size_t> count{};
+
+    view.each(test::thread_executor{}, [&count](const int value, const double) {
+        ASSERT_NE(value % 3, 0);
+        ASSERT_NE(value % 5, 0);
+        ++count;
+    });
+
+    ASSERT_EQ(count, expected.size());
+
+    registry.emplace<char>(expected.back());
+    registry.erase<float>(registry.view<float>().front());
+
+    ASSERT_FALSE(view.exclusion_cache());
+
+    visited.clear();
+    view.each([&visited](const auto entity, auto &&...) {
+        visited.push_back(entity);
+    });
+
+    ASSERT_EQ(visited.size(), expected.size());
+    ASSERT_EQ(std::find(visited.cbegin(), visited.cend(), expected.back()), visited.cend());
+
+    view.exclusion_cache(true);
+
+    ASSERT_TRUE(view.exclusion_cache());
+
+    std::vector<indexed_entity> cached{};
+    view.each([&cached](const auto entity, auto &&...) {
+        cached.push_back(entity);
+    });
+
+    ASSERT_EQ(cached, visited);
+
+    view.exclusion_cache(false);
+
+    ASSERT_FALSE(view.exclusion_cache());
+}
+
+TEST(MultiComponentView, EachIf) {
+    entt::registry registry;
+    std::vector<entt::entity> expected{};
+
+    for(int pos{}; pos < 500; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<stable_type>(entity, pos);
+
+        if(pos % 2 == 0) {
+            registry.emplace<char>(entity);
+        }
+
+        if(pos % 7 == 0) {
+            registry.emplace<double>(entity);
+        }
+
+        if((pos < 100) && (pos % 2 == 0) && (pos % 7 != 0) && (pos % 5 != 0)) {
+            expected.push_back(entity);
+        }
+    }
+
+    for(auto [entity, elem]: registry.view<stable_type>().each()) {
+        if(elem.value % 5 == 0) {
+            registry.erase<stable_type>(entity);
+        }
+    }
+
+    const auto view = registry.view<stable_type, char>(entt::exclude<double>);
+    std::vector<entt::entity> visited{};
+
+    view.each_if<stable_type>([](const stable_type &elem) { return elem.value < 100; }, [&visited](const auto entity, const stable_type &elem, char) {
+        ASSERT_LT(elem.value, 100);
+        visited.push_back(entity);
+    });
+
+    ASSERT_EQ(visited.size(), expected.size());
+    ASSERT_TRUE(std::is_permutation(visited.cbegin(), visited.cend(), expected.cbegin()));
+
+    std::size_t count{};
+    view.each_if<char>([](const char) { return false; }, [&count](const stable_type &, char) { ++count; });
+
+    ASSERT_EQ(count, 0u);
+}
+
 TEST(MultiComponentView, ConstNonConstAndAllInBetween) {
     entt::registry registry;
     auto view = registry.view<int, empty_type, const char>();
@@ -1225,6 +1660,87 @@ TEST(MultiComponentView, EmptyTypes) {
     }
 }
 
+TEST(MultiComponentView, DisabledEntities) {
+    entt::storage<int> storage{};
+    entt::storage<char> other{};
+    entt::basic_view view{storage, other};
+    const entt::entity entity[3u]{entt::entity{1}, entt::entity{3}, entt::entity{42}};
+
+    for(auto entt: entity) {
+        storage.emplace(entt);
+        other.emplace(entt);
+    }
+
+    other.emplace(entt::entity{2});
+    storage.disable(entity[1u]);
+    other.disable(entity[1u]);
+
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 2);
+    ASSERT_FALSE(view.contains(entity[1u]));
+    ASSERT_EQ(view.find(entity[1u]), view.end());
+    ASSERT_NE(view.back(), entity[1u]);
+
+    for(auto [entt, ivalue, cvalue]: view.each()) {
+        ASSERT_NE(entt, entity[1u]);
+    }
+
+    std::size_t count{};
+    view.each([&count, &entity](const auto entt, auto &&...) { ASSERT_NE(entt, entity[1u]); ++count; });
+
+    ASSERT_EQ(count, 2u);
+
+    view.use<char>();
+    count = 0u;
+    view.each([&count, &entity](const auto entt, auto &&...) { ASSERT_NE(entt, entity[1u]); ++count; });
+
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 2);
+}
+
+TEST(MultiComponentView, DisabledEntitiesNotLeading) {
+    entt::storage<int> storage{};
+    entt::storage<char> other{};
+    entt::storage<stable_type> stable{};
+    entt::basic_view view{storage, other, stable};
+    const entt::entity entity[3u]{entt::entity{1}, entt::entity{3}, entt::entity{42}};
+
+    for(auto entt: entity) {
+        storage.emplace(entt);
+        other.emplace(entt);
+        stable.emplace(entt);
+    }
+
+    other.emplace(entt::entity{2});
+    stable.emplace(entt::entity{2});
+    other.disable(entity[1u]);
+    stable.disable(entity[2u]);
+
+    ASSERT_EQ(view.handle(), &storage);
+    ASSERT_FALSE(view.contains(entity[1u]));
+    ASSERT_FALSE(view.contains(entity[2u]));
+    ASSERT_EQ(view.find(entity[1u]), view.end());
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 1);
+
+    std::size_t count{};
+    view.each([&count, &entity](const auto entt, auto &&...) { ASSERT_EQ(entt, entity[0u]); ++count; });
+
+    ASSERT_EQ(count, 1u);
+
+    view.use<stable_type>();
+    count = 0u;
+    view.each([&count, &entity](const auto entt, auto &&...) { ASSERT_EQ(entt, entity[0u]); ++count; });
+
+    ASSERT_EQ(count, 1u);
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 1);
+
+    other.enable(entity[1u]);
+    stable.enable(entity[2u]);
+
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 3);
+    ASSERT_TRUE(view.contains(entity[1u]));
+    ASSERT_TRUE(view.contains(entity[2u]));
+}
+
 TEST(MultiComponentView, FrontBack) {
     entt::registry registry;
     auto view = registry.view<const int, const char>();
@@ -0,0 +1,232 @@
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/graph/compressed_graph.hpp>
+#include "../common/throwing_allocator.hpp"
+
+using edge_list = std::vector<std::pair<std::size_t, std::size_t>>;
+
+TEST(CompressedGraph, Constructors) {
+    const edge_list edges{{0u, 1u}, {1u, 2u}};
+    entt::compressed_graph<> graph{};
+
+    ASSERT_EQ(graph.size(), 0u);
+    ASSERT_EQ(graph.edge_count(), 0u);
+
+    graph = entt::compressed_graph<>{std::allocator<std::size_t>{}};
+    graph = entt::compressed_graph<>{3u, edges.cbegin(), edges.cend(), std::allocator<std::size_t>{}};
+
+    ASSERT_EQ(graph.size(), 3u);
+    ASSERT_EQ(graph.edge_count(), 2u);
+
+    entt::compressed_graph<> temp{graph, graph.get_allocator()};
+    entt::compressed_graph<> other{std::move(graph), graph.get_allocator()};
+
+    ASSERT_EQ(graph.size(), 0u);
+    ASSERT_EQ(temp.size(), 3u);
+    ASSERT_EQ(other.size(), 3u);
+
+    ASSERT_FALSE(graph.contains(0u, 1u));
+    ASSERT_TRUE(temp.contains(0u, 1u));
+    ASSERT_TRUE(other.contains(0u, 1u));
+}
+
+TEST(CompressedGraph, Copy) {
+    const edge_list edges{{0u, 1u}};
+    entt::compressed_graph<> graph{3u, edges.cbegin(), edges.cend()};
+    entt::compressed_graph<> other{graph};
+
+    ASSERT_EQ(graph.size(), 3u);
+    ASSERT_EQ(other.size(), 3u);
+
+    ASSERT_TRUE(graph.contains(0u, 1u));
+    ASSERT_TRUE(other.contains(0u, 1u));
+
+    const edge_list more{{0u, 2u}, {1u, 3u}};
+    graph = entt::compressed_graph<>{4u, more.cbegin(), more.cend()};
+    other = graph;
+
+    ASSERT_EQ(other.size(), 4u);
+    ASSERT_EQ(graph.size(), 4u);
+
+    ASSERT_FALSE(other.contains(0u, 1u));
+    ASSERT_TRUE(other.contains(0u, 2u));
+    ASSERT_TRUE(other.contains(1u, 3u));
+}
+
+TEST(CompressedGraph, Move) {
+    const edge_list edges{{0u, 1u}};
+    entt::compressed_graph<> graph{3u, edges.cbegin(), edges.cend()};
+    entt::compressed_graph<> other{std::move(graph)};
+
+    ASSERT_EQ(graph.size(), 0u);
+    ASSERT_EQ(other.size(), 3u);
+
+    ASSERT_FALSE(graph.contains(0u, 1u));
+    ASSERT_TRUE(other.contains(0u, 1u));
+
+    graph = std::move(other);
+
+    ASSERT_EQ(graph.size(), 3u);
+    ASSERT_EQ(other.size(), 0u);
+
+    ASSERT_TRUE(graph.contains(0u, 1u));
+    ASSERT_FALSE(other.contains(0u, 1u));
+}
+
+TEST(CompressedGraph, Swap) {
+    const edge_list edges{{0u, 1u}};
+    entt::compressed_graph<> graph{3u, edges.cbegin(), edges.cend()};
+    entt::compressed_graph<> other{};
+
+    graph.swap(other);
+
+    ASSERT_EQ(graph.size(), 0u);
+    ASSERT_EQ(other.size(), 3u);
+
+    ASSERT_FALSE(graph.contains(0u, 1u));
+    ASSERT_TRUE(other.contains(0u, 1u));
+}
+
+TEST(CompressedGraph, Clear) {
+    const edge_list edges{{0u, 1u}, {0u, 2u}};
+    entt::compressed_graph<> graph{3u, edges.cbegin(), edges.cend()};
+
+    ASSERT_EQ(graph.size(), 3u);
+    ASSERT_TRUE(graph.contains(0u, 1u));
+    ASSERT_TRUE(graph.contains(0u, 2u));
+
+    graph.clear();
+
+    ASSERT_EQ(graph.size(), 0u);
+    ASSERT_EQ(graph.edge_count(), 0u);
+    ASSERT_FALSE(graph.contains(0u, 1u));
+    ASSERT_FALSE(graph.contains(0u, 2u));
+}
+
+TEST(CompressedGraph, Vertices) {
+    entt::compressed_graph<> graph{};
+    auto iterable = graph.vertices();
+
+    ASSERT_EQ(iterable.begin(), iterable.end());
+
+    const edge_list edges{};
+    graph = entt::compressed_graph<>{2u, edges.cbegin(), edges.cend()};
+    iterable = graph.vertices();
+
+    ASSERT_NE(iterable.begin(), iterable.end());
+
+    auto it = iterable.begin();
+
+    ASSERT_EQ(*it++, 0u);
+    ASSERT_EQ(*it, 1u);
+    ASSERT_EQ(++it, iterable.end());
+}
+
+TEST(CompressedGraph, EdgeIterator) {
+    using iterator = typename entt::compressed_graph<>::edge_iterator;
+
+    static_assert(std::is_same_v<iterator::value_type, std::pair<std::size_t, std::size_t>>);
+    static_assert(std::is_same_v<iterator::pointer, entt::input_iterator_pointer<std::pair<std::size_t, std::size_t>>>);
+    static_assert(std::is_same_v<iterator::reference, std::pair<std::size_t, std::size_t>>);
+
+    const edge_list edges{{1u, 2u}, {0u, 1u}};
+    entt::compressed_graph<> graph{3u, edges.cbegin(), edges.cend()};
+
+    const auto iterable = graph.edges();
+    iterator end{iterable.begin()};
+
+    ASSERT_EQ(end, iterable.begin());
+    ASSERT_NE(end, iterable.end());
+
+    ASSERT_EQ((end++)->first, 0u);
+    ASSERT_EQ((end++)->second, 2u);
+    ASSERT_EQ(end, iterable.end());
+
+    end = iterable.begin();
+
+    ASSERT_EQ(*(++end), std::make_pair(std::size_t{1u}, std::size_t{2u}));
+}
+
+TEST(CompressedGraph, Edges) {
+    const edge_list edges{{3u, 1u}, {0u, 2u}, {0u, 1u}, {3u, 1u}, {1u, 0u}};
+    entt::compressed_graph<> graph{4u, edges.cbegin(), edges.cend()};
+    auto iterable = graph.edges();
+
+    ASSERT_EQ(graph.edge_count(), 4u);
+
+    auto it = iterable.begin();
+
+    ASSERT_NE(it, iterable.end());
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{0u}, std::size_t{1u}));
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{0u}, std::size_t{2u}));
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{1u}, std::size_t{0u}));
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{3u}, std::size_t{1u}));
+    ASSERT_EQ(it, iterable.end());
+
+    ASSERT_TRUE(graph.contains(3u, 1u));
+    ASSERT_FALSE(graph.contains(1u, 3u));
+    ASSERT_FALSE(graph.contains(2u, 0u));
+    ASSERT_FALSE(graph.contains(4u, 0u));
+}
+
+TEST(CompressedGraph, OutEdges) {
+    const edge_list edges{{0u, 1u}, {1u, 2u}, {0u, 2u}};
+    entt::compressed_graph<> graph{3u, edges.cbegin(), edges.cend()};
+    auto iterable = graph.out_edges(0u);
+
+    ASSERT_EQ(graph.out_degree(0u), 2u);
+    ASSERT_EQ(graph.out_degree(1u), 1u);
+    ASSERT_EQ(graph.out_degree(2u), 0u);
+
+    auto it = iterable.begin();
+
+    ASSERT_NE(it, iterable.end());
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{0u}, std::size_t{1u}));
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{0u}, std::size_t{2u}));
+    ASSERT_EQ(it, iterable.end());
+
+    iterable = graph.out_edges(2u);
+
+    ASSERT_EQ(iterable.begin(), iterable.end());
+}
+
+TEST(CompressedGraph, InEdges) {
+    const edge_list edges{{0u, 1u}, {1u, 2u}, {0u, 2u}};
+    entt::compressed_graph<> graph{3u, edges.cbegin(), edges.cend()};
+    auto iterable = graph.in_edges(2u);
+
+    ASSERT_EQ(graph.in_degree(0u), 0u);
+    ASSERT_EQ(graph.in_degree(1u), 1u);
+    ASSERT_EQ(graph.in_degree(2u), 2u);
+
+    auto it = iterable.begin();
+
+    ASSERT_NE(it, iterable.end());
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{0u}, std::size_t{2u}));
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{1u}, std::size_t{2u}));
+    ASSERT_EQ(it, iterable.end());
+
+    iterable = graph.in_edges(0u);
+
+    ASSERT_EQ(iterable.begin(), iterable.end());
+}
+
+TEST(CompressedGraph, ThrowingAllocator) {
+    using allocator = test::throwing_allocator<std::size_t>;
+    using exception = typename allocator::exception_type;
+
+    const edge_list edges{{0u, 1u}};
+    entt::compressed_graph<allocator> graph{2u, edges.cbegin(), edges.cend()};
+
+    allocator::trigger_on_allocate = true;
+
+    ASSERT_THROW((entt::compressed_graph<allocator>{2u, edges.cbegin(), edges.cend()}), exception);
+
+    ASSERT_EQ(graph.size(), 2u);
+    ASSERT_TRUE(graph.contains(0u, 1u));
+}
@@ -322,6 +322,27 @@ TEST(Flow, Loop) {
     ASSERT_TRUE(graph.contains(1u, 0u));
 }
 
+TEST(Flow, LargeGraph) {
+    entt::flow flow{};
+
+    // enough tasks to span more than one word per row of the closure
+    for(entt::id_type next{}; next < 150u; ++next) {
+        flow.bind(next).rw(0u).ro(next % 3u + 1u);
+    }
+
+    auto graph = flow.graph();
+
+    ASSERT_EQ(flow.size(), 150u);
+    ASSERT_EQ(flow.size(), graph.size());
+    ASSERT_EQ(graph.edge_count(), 149u);
+
+    for(std::size_t pos{}; pos < 149u; ++pos) {
+        ASSERT_TRUE(graph.contains(pos, pos + 1u));
+        ASSERT_FALSE(graph.contains(pos, pos + 2u));
+        ASSERT_EQ(graph.in_degree(pos + 1u), 1u);
+    }
+}
+
 TEST(Flow, ThrowingAllocator) {
     using allocator = test::throwing_allocator<entt::id_type>;
     using task_allocator = test::throwing_allocator<std::pair<std::size_t, entt::id_type>>;
@@ -0,0 +1,121 @@
+#include <cstddef>
+#include <memory>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/graph/adjacency_matrix.hpp>
+#include <entt/graph/flow.hpp>
+#include <entt/graph/schedule.hpp>
+#include "../common/config.h"
+
+TEST(Schedule, Constructors) {
+    entt::schedule schedule{};
+
+    ASSERT_EQ(schedule.size(), 0u);
+    ASSERT_EQ(schedule.makespan(), 0.);
+    ASSERT_TRUE(schedule.order().empty());
+    ASSERT_TRUE(schedule.critical_path().empty());
+
+    schedule = entt::schedule{std::allocator<std::size_t>{}};
+
+    ASSERT_EQ(schedule.size(), 0u);
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = schedule.get_allocator());
+}
+
+TEST(Schedule, Graph) {
+    entt::adjacency_matrix<entt::directed_tag> graph{6u};
+    const double cost[6u]{1., 4., 2., 1., 3., 1.};
+
+    // 0 -> 1 -> 3 -> 5, 0 -> 2 -> 3, 4 -> 5
+    graph.insert(0u, 1u);
+    graph.insert(0u, 2u);
+    graph.insert(1u, 3u);
+    graph.insert(2u, 3u);
+    graph.insert(3u, 5u);
+    graph.insert(4u, 5u);
+
+    const entt::schedule schedule{graph, [&cost](const std::size_t vertex) { return cost[vertex]; }};
+
+    ASSERT_EQ(schedule.size(), 6u);
+    ASSERT_EQ(schedule.makespan(), 7.);
+
+    ASSERT_EQ(schedule.earliest_start(0u), 0.);
+    ASSERT_EQ(schedule.earliest_start(1u), 1.);
+    ASSERT_EQ(schedule.earliest_start(2u), 1.);
+    ASSERT_EQ(schedule.earliest_start(3u), 5.);
+    ASSERT_EQ(schedule.earliest_start(4u), 0.);
+    ASSERT_EQ(schedule.earliest_start(5u), 6.);
+
+    ASSERT_EQ(schedule.priority(0u), 7.);
+    ASSERT_EQ(schedule.priority(1u), 6.);
+    ASSERT_EQ(schedule.priority(2u), 4.);
+    ASSERT_EQ(schedule.priority(3u), 2.);
+    ASSERT_EQ(schedule.priority(4u), 4.);
+    ASSERT_EQ(schedule.priority(5u), 1.);
+
+    const auto &order = schedule.order();
+
+    ASSERT_EQ(order.size(), 6u);
+    ASSERT_EQ(order[0u], 0u);
+    ASSERT_EQ(order[1u], 1u);
+    ASSERT_EQ(order[2u], 4u);
+    ASSERT_EQ(order[3u], 2u);
+    ASSERT_EQ(order[4u], 3u);
+    ASSERT_EQ(order[5u], 5u);
+
+    const auto &path = schedule.critical_path();
+
+    ASSERT_EQ(path.size(), 4u);
+    ASSERT_EQ(path[0u], 0u);
+    ASSERT_EQ(path[1u], 1u);
+    ASSERT_EQ(path[2u], 3u);
+    ASSERT_EQ(path[3u], 5u);
+}
+
+TEST(Schedule, ZeroCost) {
+    entt::adjacency_matrix<entt::directed_tag> graph{3u};
+
+    graph.insert(2u, 1u);
+    graph.insert(1u, 0u);
+
+    const entt::schedule schedule{graph, [](auto) { return 0.; }};
+    const auto &order = schedule.order();
+
+    ASSERT_EQ(schedule.makespan(), 0.);
+    ASSERT_EQ(order.size(), 3u);
+
+    // ties preserve the topological order
+    ASSERT_EQ(order[0u], 2u);
+    ASSERT_EQ(order[1u], 1u);
+    ASSERT_EQ(order[2u], 0u);
+}
+
+TEST(Schedule, Flow) {
+    using namespace entt::literals;
+
+    entt::flow flow{};
+
+    flow.bind("task_0"_hs).rw("resource_0"_hs);
+    flow.bind("task_1"_hs).ro("resource_0"_hs);
+    flow.bind("task_2"_hs).ro("resource_0"_hs);
+    flow.bind("task_3"_hs).rw("resource_0"_hs);
+
+    entt::schedule schedule{};
+    schedule.update(flow.graph(), [](const std::size_t vertex) { return vertex == 2u ? 5. : 1.; });
+
+    ASSERT_EQ(schedule.makespan(), 7.);
+    ASSERT_EQ(schedule.earliest_start(3u), 6.);
+    ASSERT_EQ(schedule.order()[1u], 2u);
+    ASSERT_EQ(schedule.critical_path().size(), 3u);
+    ASSERT_EQ(schedule.critical_path()[1u], 2u);
+}
+
+ENTT_DEBUG_TEST(ScheduleDeathTest, Loop) {
+    entt::adjacency_matrix<entt::directed_tag> graph{2u};
+
+    graph.insert(0u, 1u);
+    graph.insert(1u, 0u);
+
+    entt::schedule schedule{};
+
+    ASSERT_DEATH(schedule.update(graph, [](auto) { return 1.; }), "");
+}